@@ -24,6 +24,34 @@
  *****************************************/
 
 #define RF24_ADDRESS_MAX_SIZE 5
+#define RF24_ADDRESS_MIN_SIZE 3
+#define RF24_NUM_OF_PIPES 6
+
+/**
+ * @brief Max payload size supported by the device.
+ */
+#define RF24_MAX_PAYLOAD_SIZE 32
+
+/**
+ * @brief Timeout value that waits with no deadline.
+ */
+#define RF24_NO_TIMEOUT 0
+
+#define RF24_SEQ_HEADER_SIZE 1
+#define RF24_SEQ_MASK 0x3F
+#define RF24_SEQ_FLAG_NO_ACK 0x40 /**< Payload sent without acknowledgement. */
+#define RF24_SEQ_FLAG_SYNC 0x80   /**< First payload of the sender, the receiver window restarts. */
+
+/*****************************************
+ * Public Macros
+ *****************************************/
+
+/**
+ * @brief Get bit value
+ */
+#ifndef _BV
+#define _BV(num) (1 << (num))
+#endif
 
 /*****************************************
  * Public Types
@@ -42,8 +70,21 @@ typedef enum rf24_status {
     RF24_INTERRUPT_NOT_CLEARED = 6,
     RF24_INVALID_PARAMETERS = 7,
     RF24_UNKNOWN_ERROR = 8,
+    RF24_BUSY = 9,
+    RF24_DUPLICATE = 10,
+    RF24_TIMEOUT = 11,
+    RF24_OUT_OF_SYNC = 12,
+    RF24_AUTHENTICATION_FAILED = 13,
 } rf24_status_t;
 
+/**
+ * @brief What is done with a payload still in the transmitter FIFO on a timeout.
+ */
+typedef enum rf24_timeout_policy {
+    RF24_TIMEOUT_FLUSH = 0, /**< The payload is flushed, stale data is never sent. */
+    RF24_TIMEOUT_RETAIN,    /**< The payload is kept, the next write sends it before its own. */
+} rf24_timeout_policy_t;
+
 /**
  * @brief Output power options for transmitter.
  *
@@ -65,6 +106,25 @@ typedef enum rf24_datarate {
     RF24_250KBPS,
 } rf24_datarate_t;
 
+/**
+ * @brief CRC length options type.
+ *
+ * @note The enumeration value is the CRC size in bytes.
+ */
+typedef enum rf24_crc_length {
+    RF24_CRC_DISABLED = 0,
+    RF24_CRC_8_BITS,
+    RF24_CRC_16_BITS,
+} rf24_crc_length_t;
+
+/**
+ * @brief Auto retransmit delay configuration modes.
+ */
+typedef enum rf24_retry_mode {
+    RF24_RETRY_DELAY_FIXED = 0, /**< Delay steps are only changed by @ref rf24_set_retries. */
+    RF24_RETRY_DELAY_AUTO,      /**< Delay steps are derived from the ACK packet airtime. */
+} rf24_retry_mode_t;
+
 /**
  * @brief Interruption request type.
  */
@@ -74,18 +134,176 @@ typedef struct rf24_irq {
     uint8_t max_retransmits : 1;
 } rf24_irq_t;
 
+/**
+ * @brief Ways to wait for the end of a transmission.
+ */
+typedef enum rf24_wait_mode {
+    RF24_WAIT_SPI_POLL = 0, /**< The status register is read until the transmission ends. */
+    RF24_WAIT_IRQ_PIN,      /**< The IRQ pin is read, the status register only once it asserts. */
+} rf24_wait_mode_t;
+
+/**
+ * @brief Device power states.
+ */
+typedef enum rf24_power_state {
+    RF24_POWER_DOWN = 0,
+    RF24_STANDBY_I,
+    RF24_STANDBY_II,
+    RF24_RX_MODE,
+    RF24_TX_MODE,
+    RF24_NUM_OF_POWER_STATES,
+} rf24_power_state_t;
+
+/**
+ * @brief Sequence number window of a receiver pipe.
+ */
+typedef struct rf24_seq_window {
+    uint8_t  last_seq;
+    uint16_t history;     /**< Bit n is set when last_seq - n was received. */
+    bool     last_sync;   /**< Whether the payload of last_seq carried the sync flag. */
+    bool     valid;
+
+    uint32_t received;
+    uint32_t duplicates;
+    uint32_t gaps;        /**< Sequence numbers skipped, an estimate of lost payloads. */
+} rf24_seq_window_t;
+
+/**
+ * @brief Power manager type.
+ */
+typedef struct rf24_power_manager {
+    rf24_power_state_t state;
+    uint32_t           state_entry_us;                              /**< Time the current state was entered. */
+    uint32_t           last_activity_us;                            /**< Time of the last transmission or reception. */
+    uint32_t           idle_timeout_us;                             /**< Idle time before powering down, 0 disables it. */
+    uint32_t           wake_latency_us;                             /**< Max time allowed to wake up the device. */
+    uint64_t           residency_us[RF24_NUM_OF_POWER_STATES];      /**< Time spent on each state. */
+    uint32_t           wake_ups;                                    /**< Times the device was woken from power down. */
+} rf24_power_manager_t;
+
+/**
+ * @brief Payload received callback type.
+ *
+ * @param p_context   Context set along with the callbacks.
+ * @param pipe_number Pipe the payload came from.
+ * @param payload     Pointer to the payload, valid during the call only.
+ * @param len         Payload size.
+ */
+typedef void (*rf24_rx_callback_t)(void* p_context, uint8_t pipe_number, uint8_t* payload, uint8_t len);
+
+/**
+ * @brief Payload sent callback type.
+ *
+ * @note On a receiver it is called when its own ACK payload was sent.
+ *
+ * @param p_context   Context set along with the callbacks.
+ * @param ack_payload Pointer to the ACK payload received, NULL when there is none or on a receiver.
+ * @param len         ACK payload size.
+ */
+typedef void (*rf24_tx_done_callback_t)(void* p_context, uint8_t* ack_payload, uint8_t len);
+
+/**
+ * @brief Event without data callback type.
+ *
+ * @param p_context Context set along with the callbacks.
+ */
+typedef void (*rf24_event_callback_t)(void* p_context);
+
+/**
+ * @brief Device event callbacks type, dispatched from @ref rf24_irq_callback.
+ *
+ * @note Any callback may be NULL.
+ */
+typedef struct rf24_callbacks {
+    rf24_rx_callback_t      on_rx;             /**< Called for each payload in the receiver FIFO. */
+    rf24_tx_done_callback_t on_tx_done;
+    rf24_event_callback_t   on_max_rt;         /**< The payload stays in the transmitter FIFO. */
+    rf24_event_callback_t   on_fifo_overflow;  /**< The receiver FIFO was full, later payloads were dropped. */
+    void*                   p_context;
+} rf24_callbacks_t;
+
+/**
+ * @brief Link activity type.
+ */
+typedef struct rf24_link {
+    uint32_t last_rx_us[RF24_NUM_OF_PIPES];  /**< Time of the last payload read from each pipe. */
+    uint32_t rx_count[RF24_NUM_OF_PIPES];    /**< Payloads read from each pipe. */
+    uint8_t  consecutive_max_rt;             /**< Transmissions failed in a row, saturates at 255. */
+} rf24_link_t;
+
+/**
+ * @brief Event timestamps type, taken with @ref rf24_get_time_us.
+ *
+ * @note Payloads read in a row after the same receiver interruption
+ *       share its timestamp, the FIFO does not keep arrival times.
+ */
+typedef struct rf24_timestamps {
+    uint32_t irq_edge_us;     /**< Time of the IRQ edge being handled, see @ref rf24_set_irq_edge_time. */
+    bool     irq_edge_valid;
+    uint32_t rx_ready_us;     /**< Time the payloads in the receiver FIFO were detected. */
+    bool     rx_ready_valid;
+    uint32_t rx_us;           /**< Arrival time of the last payload read. */
+    uint32_t tx_done_us;      /**< Time the last transmission ended, sent or failed. */
+} rf24_timestamps_t;
+
+/**
+ * @brief Device registers configuration type.
+ *
+ * @note Holds the value of every configuration register, see
+ *       @ref rf24_build_config and @ref rf24_apply_config.
+ */
+typedef struct rf24_config {
+    nrf24l01_reg_config_t     config;
+    nrf24l01_reg_en_aa_t      en_aa;
+    nrf24l01_reg_en_rxaddr_t  en_rxaddr;
+    nrf24l01_reg_setup_aw_t   setup_aw;
+    nrf24l01_reg_setup_retr_t setup_retr;
+    nrf24l01_reg_rf_ch_t      rf_ch;
+    nrf24l01_reg_rf_setup_t   rf_setup;
+    uint8_t                   rx_addr_p0[RF24_ADDRESS_MAX_SIZE];
+    uint8_t                   rx_addr_p1[RF24_ADDRESS_MAX_SIZE];
+    uint8_t                   rx_addr_p2_to_p5[RF24_NUM_OF_PIPES - 2];  /**< Pipes 2 to 5 only have the LSByte. */
+    uint8_t                   tx_addr[RF24_ADDRESS_MAX_SIZE];
+    uint8_t                   rx_pw[RF24_NUM_OF_PIPES];
+    nrf24l01_reg_dynpd_t      dynpd;
+    nrf24l01_reg_feature_t    feature;
+} rf24_config_t;
+
 /**
  * @brief rf24 device type.
  */
 typedef struct rf24_dev {
-    rf24_platform_t platform_setup;
+    rf24_platform_t      platform_setup;
+
+    uint8_t              payload_size;
+    uint8_t              addr_width;
+    rf24_datarate_t      datarate;
+    uint8_t              channel;
+    rf24_crc_length_t    crc_length;
+
+    rf24_retry_mode_t    retry_mode;
+    uint8_t              retry_delay_steps;                              /**< Auto retransmit delay steps, each one is 250us. */
+    uint8_t              retransmit_count;                               /**< Auto retransmit count. */
+    uint8_t              ack_payload_size;                               /**< Largest ACK payload expected, in bytes. */
+    rf24_wait_mode_t     wait_mode;
 
-    uint8_t         payload_size;
-    uint8_t         addr_width;
-    rf24_datarate_t datarate;
-    uint8_t         channel;
+    uint8_t              pipe0_reading_address[RF24_ADDRESS_MAX_SIZE];   /**< Last address set on pipe 0 for reading. */
+    uint8_t              pipe_payload_size[RF24_NUM_OF_PIPES];           /**< Static payload size of each pipe, 0 uses payload_size. */
 
-    uint8_t         pipe0_reading_address[RF24_ADDRESS_MAX_SIZE];     /**< Last address set on pipe 0 for reading. */
+    rf24_config_t        reg_image;                                      /**< Last values written to the registers. */
+    bool                 reg_image_valid;                                /**< Whether reg_image matches the device. */
+
+    rf24_power_manager_t power;
+
+    bool                 seq_enabled;                                    /**< Whether payloads carry the sequence header. */
+    bool                 seq_sync_pending;                               /**< Whether the next payload has the sync flag. */
+    uint8_t              tx_seq;                                         /**< Sequence number of the next payload sent. */
+    rf24_seq_window_t    seq_windows[RF24_NUM_OF_PIPES];
+
+    rf24_link_t          link;
+    rf24_timestamps_t    timestamps;
+
+    rf24_callbacks_t     callbacks;
 } rf24_dev_t;
 
 /*****************************************
@@ -110,6 +328,68 @@ rf24_status_t rf24_get_default_config(rf24_dev_t* p_dev);
  */
 rf24_status_t rf24_init(rf24_dev_t* p_dev);
 
+/**
+ * @brief Initializes device keeping the configuration it already has.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @note Meant to be used after a microcontroller reset while the device was
+ *       still powered. The registers are read in one sweep and only the ones
+ *       that differ from the configuration @ref rf24_init would set are
+ *       written. Reading pipes addresses and widths are kept.
+ *
+ * @note FIFOs are only flushed if the frame format or the transmission
+ *       address changed, so queued packets are not lost. The power up delay
+ *       is skipped if the device is already powered up.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_warm_init(rf24_dev_t* p_dev);
+
+/**
+ * @brief Reads every configuration register from the device.
+ *
+ * @param p_dev    Pointer to rf24 device.
+ * @param p_config Pointer to the configuration to be filled.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_read_config(rf24_dev_t* p_dev, rf24_config_t* p_config);
+
+/**
+ * @brief Builds the registers configuration described by the device.
+ *
+ * @param p_dev    Pointer to rf24 device.
+ * @param p_config Pointer to the configuration to be filled.
+ *
+ * @note Address width, CRC length, retries, data rate and channel are taken
+ *       from the device. Every other register keeps its last written value,
+ *       or its reset value if the device registers are unknown.
+ */
+void rf24_build_config(rf24_dev_t* p_dev, rf24_config_t* p_config);
+
+/**
+ * @brief Writes a registers configuration to the device.
+ *
+ * @param p_dev    Pointer to rf24 device.
+ * @param p_config Pointer to the configuration to be written.
+ * @param verify   Whether the written registers are read back or not.
+ *
+ * @note Only registers that differ from the last written values are
+ *       written, or all of them if those are unknown. The address width is
+ *       written first and the config register last, so the device is
+ *       powered up already configured.
+ *
+ * @note When verifying, every written register is read once after all
+ *       the writes.
+ *
+ * @note The device address width, CRC length, retries, data rate and
+ *       channel are updated from the configuration.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_apply_config(rf24_dev_t* p_dev, const rf24_config_t* p_config, bool verify);
+
 /**
  * @brief Power up device.
  *
@@ -128,6 +408,72 @@ rf24_status_t rf24_power_up(rf24_dev_t* p_dev);
  */
 rf24_status_t rf24_power_down(rf24_dev_t* p_dev);
 
+/**
+ * @brief Configures automatic power down when the device is idle.
+ *
+ * @param p_dev           Pointer to rf24 device.
+ * @param idle_timeout_us Time without transmissions before powering down, 0 disables it.
+ * @param wake_latency_us Max time allowed to wake up the device for the next operation.
+ *
+ * @note The device goes to power down only if waking up from it fits in
+ *       the latency budget, otherwise it stays in standby-I. The device
+ *       is woken up by the next @ref rf24_write or @ref rf24_start_listening.
+ *
+ * @note The receiver mode is only left by @ref rf24_stop_listening.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_power_manager_config(rf24_dev_t* p_dev, uint32_t idle_timeout_us, uint32_t wake_latency_us);
+
+/**
+ * @brief Updates power manager, powering down the device if it is idle.
+ *
+ * @note A device left transmitting by @ref rf24_write_fast or
+ *       @ref rf24_write_continuously is in standby-II once its TX FIFO
+ *       empties, and is taken to standby-I when idle. The receiver mode is
+ *       never left, a listening device is not idle.
+ *
+ * @note This function should be called periodically.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_power_manager_update(rf24_dev_t* p_dev);
+
+/**
+ * @brief Gets the time needed to start transmitting or receiving from a power state.
+ *
+ * @param state Power state.
+ *
+ * @return Wake latency in microseconds.
+ */
+uint32_t rf24_get_wake_latency_us(rf24_power_state_t state);
+
+/**
+ * @brief Gets device current power state.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_power_state.
+ */
+rf24_power_state_t rf24_get_power_state(rf24_dev_t* p_dev);
+
+/**
+ * @brief Gets the time spent on each power state, useful for energy estimation.
+ *
+ * @param p_dev        Pointer to rf24 device.
+ * @param residency_us Array to store the time spent on each @ref rf24_power_state, in microseconds.
+ */
+void rf24_get_power_residency(rf24_dev_t* p_dev, uint64_t residency_us[RF24_NUM_OF_POWER_STATES]);
+
+/**
+ * @brief Resets the time spent on each power state.
+ *
+ * @param p_dev Pointer to rf24 device.
+ */
+void rf24_reset_power_residency(rf24_dev_t* p_dev);
+
 /**
  * @brief Sets device operating channel.
  *
@@ -170,16 +516,200 @@ uint8_t rf24_get_channel(rf24_dev_t* p_dev);
  * @note Retransmissions count can be up to 15. If set to zero
  *       retransmission is disabled.
  *
+ * @note The retry mode is set to @ref RF24_RETRY_DELAY_FIXED.
+ *
  * @return @ref rf24_status.
  */
 rf24_status_t rf24_set_retries(rf24_dev_t* p_dev, uint8_t delay_steps, uint8_t rt_count);
 
+/**
+ * @brief Sets retries configuration with the delay derived from the frame format.
+ *
+ * @param p_dev    Pointer to rf24 device.
+ * @param rt_count Count of retransmissions.
+ *
+ * @note The delay is set to the smallest value that still allows the ACK
+ *       packet to be received, see @ref rf24_get_min_retry_delay_steps. It is
+ *       derived again every time the data rate, address width, CRC length or
+ *       ACK payload size changes, until @ref rf24_set_retries is called.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_set_auto_retries(rf24_dev_t* p_dev, uint8_t rt_count);
+
+/**
+ * @brief Gets the smallest retransmission delay steps for the current
+ *        frame format.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @note The delay must cover the receiver settling time and the ACK packet
+ *       airtime, and is never smaller than the datasheet limits for the
+ *       data rate and ACK payload size.
+ *
+ * @return Delay steps, each one is 250us.
+ */
+uint8_t rf24_get_min_retry_delay_steps(rf24_dev_t* p_dev);
+
+/**
+ * @brief Sets the largest ACK payload size expected by the transmitter.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param size  ACK payload size in bytes, 0 if ACK payloads aren't used.
+ *
+ * @note When using @ref RF24_RETRY_DELAY_AUTO the retransmission delay is updated.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_set_ack_payload_size(rf24_dev_t* p_dev, uint8_t size);
+
+/**
+ * @brief Enables or disables the sequence header on sent and received payloads.
+ *
+ * @note The one byte header holds a 6 bit sequence number and flags, see
+ *       @ref RF24_SEQ_MASK. Receivers drop duplicates, like payloads sent
+ *       again after a lost acknowledgement, using a window per pipe.
+ *       Transmitter and receiver must match.
+ *
+ * @note The header takes one byte of the payload, see @ref rf24_get_payload_capacity.
+ *
+ * @param p_dev  Pointer to rf24 device.
+ * @param enable Whether the sequence header is enabled or not.
+ */
+void rf24_enable_seq_header(rf24_dev_t* p_dev, bool enable);
+
+/**
+ * @brief Gets the sequence window of a pipe, with its counters.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param pipe_number Number of the pipe.
+ * @param p_window    Pointer to store the window.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_get_seq_window(rf24_dev_t* p_dev, uint8_t pipe_number, rf24_seq_window_t* p_window);
+
+/**
+ * @brief Gets the number of data bytes that fit in a payload.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return Payload size minus the headers added by the driver.
+ */
+uint8_t rf24_get_payload_capacity(rf24_dev_t* p_dev);
+
+/**
+ * @brief Gets the time taken by a single packet transmission.
+ *
+ * @param p_dev           Pointer to rf24 device.
+ * @param payload_len     Payload length in bytes.
+ * @param enable_auto_ack Whether an ACK packet is expected or not.
+ *
+ * @note The frame has preamble, address, packet control field, payload and
+ *       CRC. The TX settling time is always included and, when auto
+ *       acknowledgement is enabled, the RX settling time and the ACK packet,
+ *       with @ref rf24_dev_t::ack_payload_size bytes, are also included.
+ *
+ * @note Retransmissions are not included, see @ref rf24_worst_case_airtime_us.
+ *
+ * @return Airtime in microseconds.
+ */
+uint32_t rf24_airtime_us(rf24_dev_t* p_dev, uint8_t payload_len, bool enable_auto_ack);
+
+/**
+ * @brief Gets the time taken by a packet transmission when every
+ *        retransmission is needed.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param payload_len Payload length in bytes.
+ *
+ * @note This is the time between starting the transmission and the
+ *       max retransmits interruption.
+ *
+ * @return Airtime in microseconds.
+ */
+uint32_t rf24_worst_case_airtime_us(rf24_dev_t* p_dev, uint8_t payload_len);
+
+/**
+ * @brief Gets the max payload throughput when packets are sent back to back.
+ *
+ * @param p_dev           Pointer to rf24 device.
+ * @param payload_len     Payload length in bytes.
+ * @param enable_auto_ack Whether an ACK packet is expected or not.
+ *
+ * @note SPI transfers are not taken into account.
+ *
+ * @return Throughput in payload bytes per second.
+ */
+uint32_t rf24_max_throughput(rf24_dev_t* p_dev, uint8_t payload_len, bool enable_auto_ack);
+
+/**
+ * @brief Sets the frame format, address width and CRC length.
+ *
+ * @param p_dev      Pointer to rf24 device.
+ * @param addr_width Address width in bytes, from 3 to 5.
+ * @param crc_length CRC length.
+ *
+ * @note The addresses of the enabled reading pipes are checked to still be
+ *       unique when truncated to the new width.
+ *
+ * @note CRC can only be disabled if auto acknowledgement is disabled on all
+ *       pipes, see @ref rf24_set_auto_ack.
+ *
+ * @note Shorter addresses and CRC reduce the packet overhead, see @ref rf24_airtime_us.
+ *       When using @ref RF24_RETRY_DELAY_AUTO the retransmission delay is updated.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_set_frame_format(rf24_dev_t* p_dev, uint8_t addr_width, rf24_crc_length_t crc_length);
+
+/**
+ * @brief Enables or disables auto acknowledgement on a receiver pipe.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param pipe_number Number of the pipe.
+ * @param enable      Whether auto acknowledgement is enabled or not.
+ *
+ * @note Auto acknowledgement requires CRC to be enabled.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_set_auto_ack(rf24_dev_t* p_dev, uint8_t pipe_number, bool enable);
+
+/**
+ * @brief Sets the static payload size of a receiver pipe.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param pipe_number Number of the pipe.
+ * @param size        Payload size in bytes, from 1 to 32, or 0 to use the device payload size.
+ *
+ * @note Pipes with dynamic payload length ignore this size, see @ref rf24_enable_ack_payload.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_set_pipe_payload_size(rf24_dev_t* p_dev, uint8_t pipe_number, uint8_t size);
+
+/**
+ * @brief Enables or disables payloads on acknowledgement packets.
+ *
+ * @param p_dev  Pointer to rf24 device.
+ * @param enable Whether ACK payloads are enabled or not.
+ *
+ * @note ACK payloads require dynamic payload length, which is enabled on
+ *       all pipes along with them. Transmitter and receiver must match.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_enable_ack_payload(rf24_dev_t* p_dev, bool enable);
+
 /**
  * @brief Set device data rate.
  *
  * @param p_dev    Pointer to rf24 device.
  * @param datarate Selected data rate.
  *
+ * @note When using @ref RF24_RETRY_DELAY_AUTO the retransmission delay is updated.
+ *
  * @return @ref rf24_status.
  */
 rf24_status_t rf24_set_datarate(rf24_dev_t* p_dev, rf24_datarate_t datarate);
@@ -278,6 +808,9 @@ rf24_status_t rf24_available(rf24_dev_t* p_dev, uint8_t* pipe_number);
  *
  * @note Interruption flags related to the receiver are cleared.
  *
+ * @note With the sequence header enabled the header is removed, and
+ *       duplicates return @ref RF24_DUPLICATE.
+ *
  * @param p_dev Pointer to rf24 device.
  * @param buff Pointer to a buffer where the data should be written
  * @param len Maximum number of bytes to read into the buffer
@@ -286,6 +819,46 @@ rf24_status_t rf24_available(rf24_dev_t* p_dev, uint8_t* pipe_number);
  */
 rf24_status_t rf24_read(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len);
 
+/**
+ * @brief Reads the next payload in the receiver FIFO along with its pipe and size.
+ *
+ * @note The size is the pipe static payload size, or the received length
+ *       when dynamic payload length is enabled.
+ *
+ * @note Interruption flags related to the receiver are cleared.
+ *
+ * @note With the sequence header enabled the header is removed and
+ *       duplicates are dropped.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param buff Pointer to a buffer where the data should be written
+ * @param len Size of the buffer
+ * @param p_pipe Pointer to store the pipe the payload came from
+ * @param p_size Pointer to store the payload size
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY No payload available.
+ */
+rf24_status_t rf24_read_next(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size);
+
+/**
+ * @brief Waits for the next payload, up to a deadline, see @ref rf24_read_next.
+ *
+ * @note @ref rf24_get_time_us must be implemented for the deadline to pass.
+ *
+ * @param p_dev      Pointer to rf24 device.
+ * @param buff       Pointer to a buffer where the data should be written
+ * @param len        Size of the buffer
+ * @param p_pipe     Pointer to store the pipe the payload came from
+ * @param p_size     Pointer to store the payload size
+ * @param timeout_us Max time to wait, or @ref RF24_NO_TIMEOUT.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_TIMEOUT No payload arrived before the deadline.
+ */
+rf24_status_t rf24_read_timeout(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size,
+                                uint32_t timeout_us);
+
 /**
  * @brief Writes data in the transmission FIFO, data to be sent to the receiver.
  *
@@ -303,14 +876,77 @@ rf24_status_t rf24_read(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len);
  */
 rf24_status_t rf24_write(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack);
 
+/**
+ * @brief Writes data like @ref rf24_write, giving up at a deadline.
+ *
+ * @note On the deadline the chip is disabled and the payload is flushed
+ *       or kept in the transmitter FIFO according to the policy. Payloads
+ *       already in the FIFO are sent first, the call ends with the FIFO
+ *       empty, and a retransmission failure flushes all of them.
+ *
+ * @note @ref rf24_get_time_us must be implemented for the deadline to pass.
+ *
+ * @param p_dev           Pointer to rf24 device.
+ * @param buff            Pointer to the data to be sent
+ * @param len             Number of bytes to be sent
+ * @param enable_auto_ack Whether auto acknowledgement is enabled or not.
+ * @param timeout_us      Max time to wait for the transmission, or @ref RF24_NO_TIMEOUT.
+ * @param policy          @ref rf24_timeout_policy_t.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_TIMEOUT The transmission did not end before the deadline.
+ */
+rf24_status_t rf24_write_timeout(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack,
+                                 uint32_t timeout_us, rf24_timeout_policy_t policy);
+
+/**
+ * @brief Writes data in the transmission FIFO and starts sending it, without waiting.
+ *
+ * @note Up to three payloads can be queued, use @ref rf24_tx_standby to
+ *       wait for all of them to be sent.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param buff Pointer to the data to be sent
+ * @param len Number of bytes to be sent
+ * @param enable_auto_ack Whether auto acknowledgement is enabled or not.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_TX_FIFO_FULL No room for the payload.
+ */
+rf24_status_t rf24_write_fast(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack);
+
+/**
+ * @brief Waits for the transmission FIFO to be sent and goes back to standby.
+ *
+ * @note On max retransmissions the remaining payloads are flushed.
+ *       Interruption flags related to the transmitter are cleared.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_tx_standby(rf24_dev_t* p_dev);
+
+/**
+ * @brief Drops the transmission FIFO and goes back to standby, without waiting.
+ *
+ * @note A payload already on air is completed, it may still be received.
+ *       Interruption flags related to the transmitter are cleared.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_tx_abort(rf24_dev_t* p_dev);
+
 /**
  * @brief Writes data in the transmission FIFO, data to be sent continuously to the receiver.
  *
  * @note Be sure to call @ref rf24_open_writing_pipe first to set the
  *       destination of where to write to.
  *
- * @note Auto acknowledgement and auto retransmit will be disabled in this mode, make sure to
- *       re-configure the device after using this function.
+ * @note Auto acknowledgement and auto retransmit will be disabled in this mode, use
+ *       @ref rf24_stop_write_continuously to stop sending and restore them.
  *
  * @note Interruption flags related to the transmitter are NOT cleared.
  *
@@ -322,6 +958,33 @@ rf24_status_t rf24_write(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool ena
  */
 rf24_status_t rf24_write_continuously(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len);
 
+/**
+ * @brief Stops a transmission started by @ref rf24_write_continuously.
+ *
+ * @note The transmitter FIFO is flushed and the retries configuration
+ *       is restored.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_stop_write_continuously(rf24_dev_t* p_dev);
+
+/**
+ * @brief Writes a payload to be sent with the next acknowledgement of a pipe.
+ *
+ * @note ACK payloads must be enabled, see @ref rf24_enable_ack_payload.
+ *       Up to three payloads can be pending, shared by all pipes.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param pipe_number Number of the pipe
+ * @param buff Pointer to the data to be sent
+ * @param len Number of bytes to be sent
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_write_ack_payload(rf24_dev_t* p_dev, uint8_t pipe_number, uint8_t* buff, uint8_t len);
+
 /**
  * @brief Gets status register value.
  *
@@ -344,9 +1007,67 @@ nrf24l01_reg_status_t rf24_get_status(rf24_dev_t* p_dev);
  */
 rf24_status_t rf24_set_irq_configuration(rf24_dev_t* p_dev, rf24_irq_t irq_config);
 
+/**
+ * @brief Sets how the write functions wait for the end of a transmission.
+ *
+ * @note @ref RF24_WAIT_IRQ_PIN enables the transmitter interruptions on the
+ *       IRQ pin, keeping the receiver one as it is, and needs the pin wired
+ *       to irq_port and irq_pin. While the receiver interruption is pending
+ *       the pin stays asserted and the wait falls back to reading the status.
+ *
+ * @param p_dev     Pointer to rf24 device.
+ * @param wait_mode @ref rf24_wait_mode_t.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_set_wait_mode(rf24_dev_t* p_dev, rf24_wait_mode_t wait_mode);
+
+/**
+ * @brief Sets the event callbacks dispatched from @ref rf24_irq_callback.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param p_callbacks Pointer to the callbacks, NULL removes them.
+ */
+void rf24_set_callbacks(rf24_dev_t* p_dev, const rf24_callbacks_t* p_callbacks);
+
+/**
+ * @brief Sets the time of the IRQ edge handled by the next @ref rf24_irq_callback.
+ *
+ * @note Only needed when the interruption is handled later than the edge,
+ *       otherwise the callback takes the time itself.
+ *
+ * @param p_dev   Pointer to rf24 device.
+ * @param edge_us Time of the IRQ edge.
+ */
+void rf24_set_irq_edge_time(rf24_dev_t* p_dev, uint32_t edge_us);
+
+/**
+ * @brief Gets the arrival time of the last payload read.
+ *
+ * @note The time of the receiver interruption when one was handled,
+ *       otherwise the time the payload was found in the FIFO.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return Arrival time in microseconds.
+ */
+uint32_t rf24_get_rx_timestamp_us(rf24_dev_t* p_dev);
+
+/**
+ * @brief Gets the time the last transmission ended, sent or failed.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return Transmission end time in microseconds.
+ */
+uint32_t rf24_get_tx_timestamp_us(rf24_dev_t* p_dev);
+
 /**
  * @brief Gets wich type of interruption activated the IRQ pin and resets it.
  *
+ * @note The callbacks set with @ref rf24_set_callbacks are called from here,
+ *       the receiver FIFO is emptied when on_rx is set.
+ *
  * @param p_dev Pointer to rf24 device.
  *
  * @return @ref rf24_irq_t. Each member of the struct indicate if
@@ -365,4 +1086,24 @@ rf24_irq_t rf24_irq_callback(rf24_dev_t* p_dev);
  */
 rf24_status_t rf24_delay(uint32_t ms);
 
+/**
+ * @brief Library time function.
+ *
+ * @note This function should be implemented by the user when the power
+ *       manager or the event timestamps are used, from a cycle counter for
+ *       example. The default implementation always returns 0.
+ *
+ * @return Monotonic time in microseconds.
+ */
+uint32_t rf24_get_time_us(void);
+
+/**
+ * @brief Library idle function, called while waiting for the IRQ pin.
+ *
+ * @note This function may be implemented by the user to sleep until the
+ *       next event, for example with an EXTI event and WFE. The default
+ *       implementation returns at once.
+ */
+void rf24_wait_for_event(void);
+
 #endif // __RF24_H__
@@ -0,0 +1,176 @@
+/**
+ * @file rf24_aead.h
+ *
+ * @brief nRF24L01 payload authenticated encryption, with ChaCha20-Poly1305.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_AEAD_H__
+#define __RF24_AEAD_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#define RF24_AEAD_KEY_SIZE     32
+#define RF24_AEAD_COUNTER_SIZE 4
+
+/**
+ * @brief Bytes of the Poly1305 tag sent, from 4 to 16.
+ */
+#ifndef RF24_AEAD_TAG_SIZE
+#define RF24_AEAD_TAG_SIZE 8
+#endif
+
+#if (RF24_AEAD_TAG_SIZE < 4) || (RF24_AEAD_TAG_SIZE > 16)
+#error "RF24_AEAD_TAG_SIZE must be between 4 and 16"
+#endif
+
+#define RF24_AEAD_OVERHEAD (RF24_AEAD_COUNTER_SIZE + RF24_AEAD_TAG_SIZE)
+
+/**
+ * @brief Frames older than the newest one accepted that may still arrive.
+ */
+#define RF24_AEAD_REPLAY_WINDOW 32
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Receiving pipe peer type.
+ */
+typedef struct rf24_aead_peer {
+    uint32_t node_id;
+    uint32_t last_counter;  /**< Newest counter accepted. */
+    uint32_t window;        /**< Counters accepted before the newest one, bit i for last_counter - 1 - i. */
+    bool     has_counter;
+    bool     enabled;
+} rf24_aead_peer_t;
+
+/**
+ * @brief Authenticated encryption statistics type.
+ */
+typedef struct rf24_aead_stats {
+    uint32_t sealed;
+    uint32_t opened;
+    uint32_t rejected;  /**< Frames with a wrong tag, or from a pipe without peer. */
+    uint32_t replayed;  /**< Frames with a counter already accepted or older than the window. */
+} rf24_aead_stats_t;
+
+/**
+ * @brief Authenticated encryption type.
+ *
+ * @note Each frame is its counter, the ciphertext and the truncated tag.
+ *       The nonce is the sender node id and the counter, so every sender
+ *       sharing the key needs its own node id, and a counter must never be
+ *       used twice with the same key, including across resets.
+ */
+typedef struct rf24_aead {
+    rf24_dev_t*       p_dev;
+    uint32_t          key[RF24_AEAD_KEY_SIZE / 4];
+    uint32_t          node_id;
+    uint32_t          tx_counter;     /**< Counter of the next frame sealed. */
+
+    rf24_aead_peer_t  peers[RF24_NUM_OF_PIPES];
+
+    rf24_aead_stats_t stats;
+} rf24_aead_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes authenticated encryption, without peers.
+ *
+ * @param p_aead     Pointer to authenticated encryption.
+ * @param p_dev      Pointer to rf24 device.
+ * @param key        Shared key, @ref RF24_AEAD_KEY_SIZE bytes.
+ * @param node_id    Id of this sender, unique among the ones sharing the key.
+ * @param tx_counter Counter of the first frame sealed, above any counter used before.
+ */
+void rf24_aead_init(rf24_aead_t* p_aead, rf24_dev_t* p_dev, const uint8_t* key, uint32_t node_id,
+                    uint32_t tx_counter);
+
+/**
+ * @brief Accepts frames on a pipe from a sender, resetting its replay window.
+ *
+ * @param p_aead  Pointer to authenticated encryption.
+ * @param pipe    Receiving pipe.
+ * @param node_id Id of the sender.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_aead_set_peer(rf24_aead_t* p_aead, uint8_t pipe, uint32_t node_id);
+
+/**
+ * @brief Encrypts and authenticates a payload into a frame.
+ *
+ * @param p_aead Pointer to authenticated encryption.
+ * @param buff   Pointer to the payload.
+ * @param len    Payload size, up to @ref RF24_MAX_PAYLOAD_SIZE minus @ref RF24_AEAD_OVERHEAD.
+ * @param frame  Pointer to a buffer of @ref RF24_MAX_PAYLOAD_SIZE bytes to store the frame.
+ * @param p_size Pointer to store the frame size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_INVALID_PARAMETERS The payload is too long, or the counters ran out and a new key is needed.
+ */
+rf24_status_t rf24_aead_seal(rf24_aead_t* p_aead, const uint8_t* buff, uint8_t len, uint8_t* frame,
+                             uint8_t* p_size);
+
+/**
+ * @brief Authenticates and decrypts a frame received.
+ *
+ * @note Tag verification takes the same time for any forged frame.
+ *
+ * @param p_aead Pointer to authenticated encryption.
+ * @param pipe   Pipe the frame came from.
+ * @param frame  Pointer to the frame.
+ * @param size   Frame size.
+ * @param buff   Pointer to a buffer of size minus @ref RF24_AEAD_OVERHEAD bytes to store the payload.
+ * @param p_len  Pointer to store the payload size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_DUPLICATE             The frame was already accepted, or is too old.
+ * @retval RF24_AUTHENTICATION_FAILED The frame is forged or corrupted, or the pipe has no peer.
+ */
+rf24_status_t rf24_aead_open(rf24_aead_t* p_aead, uint8_t pipe, const uint8_t* frame, uint8_t size, uint8_t* buff,
+                             uint8_t* p_len);
+
+/**
+ * @brief Seals and sends a payload.
+ *
+ * @note With static payloads the payload is padded with zeros up to the
+ *       capacity before sealing.
+ *
+ * @param p_aead          Pointer to authenticated encryption.
+ * @param buff            Pointer to the payload.
+ * @param len             Payload size.
+ * @param enable_auto_ack Whether auto acknowledgement is enabled or not.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_aead_write(rf24_aead_t* p_aead, uint8_t* buff, uint8_t len, bool enable_auto_ack);
+
+/**
+ * @brief Reads the next authentic payload, dropping the frames rejected.
+ *
+ * @param p_aead Pointer to authenticated encryption.
+ * @param buff   Pointer to a buffer where the payload should be written.
+ * @param len    Size of the buffer.
+ * @param p_pipe Pointer to store the pipe the payload came from.
+ * @param p_size Pointer to store the payload size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY No authentic payload available.
+ */
+rf24_status_t rf24_aead_read(rf24_aead_t* p_aead, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size);
+
+#endif // __RF24_AEAD_H__
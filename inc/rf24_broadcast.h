@@ -0,0 +1,115 @@
+/**
+ * @file rf24_broadcast.h
+ *
+ * @brief nRF24L01 broadcast, with repeats and duplicate suppression.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_BROADCAST_H__
+#define __RF24_BROADCAST_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#define RF24_BROADCAST_HEADER_SIZE 1
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Broadcast type.
+ *
+ * @note Payloads are sent without acknowledgement to an address shared
+ *       by all listeners, with a sequence number as the first byte.
+ */
+typedef struct rf24_broadcast {
+    rf24_dev_t* p_dev;
+    uint8_t     pipe_number;  /**< Pipe the broadcast address is opened on. */
+
+    uint8_t     repeats;      /**< Times each payload is sent. */
+    uint8_t     gap_steps;    /**< Gap between repeats, each step is 250us. */
+
+    uint8_t     next_seq;
+    uint8_t     last_seq;
+    bool        has_last;
+
+    uint32_t    received;
+    uint32_t    duplicates;
+} rf24_broadcast_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a broadcast sender or listener.
+ *
+ * @param p_bc      Pointer to broadcast.
+ * @param p_dev     Pointer to rf24 device.
+ * @param repeats   Times each payload is sent, at least 1.
+ * @param gap_steps Gap between repeats, each step is 250us like the retransmission delay.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_broadcast_init(rf24_broadcast_t* p_bc, rf24_dev_t* p_dev, uint8_t repeats, uint8_t gap_steps);
+
+/**
+ * @brief Opens the broadcast address for reading.
+ *
+ * @param p_bc        Pointer to broadcast.
+ * @param pipe_number Number of the pipe, from 0 to 5.
+ * @param address     Broadcast address.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_broadcast_open_receiver(rf24_broadcast_t* p_bc, uint8_t pipe_number, uint8_t* address);
+
+/**
+ * @brief Opens the broadcast address for writing.
+ *
+ * @param p_bc    Pointer to broadcast.
+ * @param address Broadcast address.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_broadcast_open_transmitter(rf24_broadcast_t* p_bc, uint8_t* address);
+
+/**
+ * @brief Sends a payload to all listeners, repeated with gaps.
+ *
+ * @note @ref rf24_get_time_us must be implemented when the gap is not 0.
+ *
+ * @param p_bc Pointer to broadcast.
+ * @param buff Pointer to the data to be sent.
+ * @param len  Number of bytes to be sent, up to the payload size minus the header.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_broadcast_send(rf24_broadcast_t* p_bc, uint8_t* buff, uint8_t len);
+
+/**
+ * @brief Reads the next payload, dropping broadcast repeats.
+ *
+ * @note Payloads from other pipes are returned unchanged, broadcast
+ *       ones without the header.
+ *
+ * @param p_bc   Pointer to broadcast.
+ * @param buff   Pointer to a buffer where the data should be written.
+ * @param len    Size of the buffer.
+ * @param p_pipe Pointer to store the pipe the payload came from.
+ * @param p_size Pointer to store the data size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY No payload available.
+ */
+rf24_status_t rf24_broadcast_read(rf24_broadcast_t* p_bc, uint8_t* buff, uint8_t len, uint8_t* p_pipe,
+                                  uint8_t* p_size);
+
+#endif // __RF24_BROADCAST_H__
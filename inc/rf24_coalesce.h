@@ -0,0 +1,129 @@
+/**
+ * @file rf24_coalesce.h
+ *
+ * @brief nRF24L01 small message coalescing, packing several messages per payload.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_COALESCE_H__
+#define __RF24_COALESCE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+/**
+ * @brief Size of the length prefix of each message.
+ */
+#define RF24_COALESCE_RECORD_HEADER_SIZE 1
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Coalescing statistics type.
+ */
+typedef struct rf24_coalesce_stats {
+    uint32_t messages_sent;
+    uint32_t frames_sent;
+    uint32_t messages_received;
+    uint32_t frames_received;
+    uint32_t malformed;          /**< Received payloads with a record past their end. */
+} rf24_coalesce_stats_t;
+
+/**
+ * @brief Coalescing type.
+ *
+ * @note Each message is a length byte followed by its data, a length of
+ *       0 ends the payload. Messages are never split between payloads.
+ */
+typedef struct rf24_coalesce {
+    rf24_dev_t*           p_dev;
+    uint32_t              latency_us;        /**< Max time a message waits before its payload is sent. */
+    bool                  enable_auto_ack;
+
+    uint8_t               tx_buff[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t               tx_used;
+    uint32_t              tx_first_us;       /**< Time the oldest message waiting was added. */
+
+    uint8_t               rx_buff[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t               rx_size;
+    uint8_t               rx_offset;         /**< Next record to unpack. */
+    uint8_t               rx_pipe;
+
+    rf24_coalesce_stats_t stats;
+} rf24_coalesce_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a coalescing sender and receiver.
+ *
+ * @param p_co            Pointer to coalescing.
+ * @param p_dev           Pointer to rf24 device.
+ * @param latency_us      Max time a message waits before its payload is sent.
+ * @param enable_auto_ack Whether the payloads are sent with auto acknowledgement.
+ */
+void rf24_coalesce_init(rf24_coalesce_t* p_co, rf24_dev_t* p_dev, uint32_t latency_us, bool enable_auto_ack);
+
+/**
+ * @brief Adds a message to the payload being packed.
+ *
+ * @note The payload is sent first when the message does not fit, and right
+ *       after when no other message fits anymore.
+ *
+ * @param p_co Pointer to coalescing.
+ * @param buff Pointer to the message.
+ * @param len  Message size, from 1 to the payload capacity minus the length byte.
+ *
+ * @return @ref rf24_status of the payload sent, if any.
+ */
+rf24_status_t rf24_coalesce_write(rf24_coalesce_t* p_co, uint8_t* buff, uint8_t len);
+
+/**
+ * @brief Sends the payload being packed once its oldest message waited the latency budget.
+ *
+ * @note This function should be called periodically.
+ *
+ * @note @ref rf24_get_time_us must be implemented.
+ *
+ * @param p_co Pointer to coalescing.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_coalesce_update(rf24_coalesce_t* p_co);
+
+/**
+ * @brief Sends the payload being packed now, if it has any message.
+ *
+ * @param p_co Pointer to coalescing.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_coalesce_flush(rf24_coalesce_t* p_co);
+
+/**
+ * @brief Reads the next message, unpacking the received payloads.
+ *
+ * @param p_co   Pointer to coalescing.
+ * @param buff   Pointer to a buffer where the message should be written.
+ * @param len    Size of the buffer.
+ * @param p_pipe Pointer to store the pipe the message came from.
+ * @param p_size Pointer to store the message size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY No message available.
+ */
+rf24_status_t rf24_coalesce_read(rf24_coalesce_t* p_co, uint8_t* buff, uint8_t len, uint8_t* p_pipe,
+                                 uint8_t* p_size);
+
+#endif // __RF24_COALESCE_H__
@@ -0,0 +1,164 @@
+/**
+ * @file rf24_codec.h
+ *
+ * @brief nRF24L01 telemetry codec, with delta and zig-zag varint encoding.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_CODEC_H__
+#define __RF24_CODEC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#ifndef RF24_CODEC_MAX_SAMPLES
+#define RF24_CODEC_MAX_SAMPLES 16
+#endif
+
+/**
+ * @brief Frames kept by the decoder as delta references.
+ */
+#ifndef RF24_CODEC_HISTORY_SIZE
+#define RF24_CODEC_HISTORY_SIZE 4
+#endif
+
+#define RF24_CODEC_HEADER_SIZE 3
+
+/**
+ * @brief Largest encoded size of a sample, a 32 bits varint.
+ */
+#define RF24_CODEC_MAX_VARINT_SIZE 5
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Encoder type.
+ *
+ * @note Frames are encoded as deltas to the last frame acknowledged by the
+ *       receiver, or as keyframes with the samples themselves. A frame is a
+ *       header with its id, the number of samples and the reference id,
+ *       followed by a zig-zag varint per sample. Encoding and decoding take
+ *       at most @ref RF24_CODEC_MAX_VARINT_SIZE steps per sample, with no
+ *       allocation.
+ */
+typedef struct rf24_codec_encoder {
+    uint8_t  num_of_samples;
+    uint8_t  keyframe_interval;                  /**< Frames between keyframes, 0 only sends them to resync. */
+
+    int32_t  reference[RF24_CODEC_MAX_SAMPLES];  /**< Last frame acknowledged. */
+    uint8_t  reference_id;
+    bool     has_reference;
+
+    int32_t  last[RF24_CODEC_MAX_SAMPLES];       /**< Last frame encoded, waiting for its acknowledgement. */
+    uint8_t  next_id;
+    uint8_t  frames_since_keyframe;
+
+    uint32_t keyframes;                          /**< Keyframes encoded. */
+    uint32_t deltas;                             /**< Delta frames encoded. */
+} rf24_codec_encoder_t;
+
+/**
+ * @brief Decoder type, one per sending pipe.
+ */
+typedef struct rf24_codec_decoder {
+    uint8_t  num_of_samples;
+
+    int32_t  history[RF24_CODEC_HISTORY_SIZE][RF24_CODEC_MAX_SAMPLES];
+    uint8_t  history_ids[RF24_CODEC_HISTORY_SIZE];
+    uint8_t  history_count;
+    uint8_t  history_head;                       /**< Slot of the next frame decoded. */
+
+    uint32_t decoded;                            /**< Frames decoded. */
+    uint32_t out_of_sync;                        /**< Deltas dropped for a reference no longer kept. */
+} rf24_codec_decoder_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes an encoder, the first frame is a keyframe.
+ *
+ * @param p_enc             Pointer to encoder.
+ * @param num_of_samples    Samples per frame, up to @ref RF24_CODEC_MAX_SAMPLES.
+ * @param keyframe_interval Frames between keyframes, 0 only sends them to resync.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_codec_encoder_init(rf24_codec_encoder_t* p_enc, uint8_t num_of_samples, uint8_t keyframe_interval);
+
+/**
+ * @brief Encodes a frame of samples.
+ *
+ * @note Call @ref rf24_codec_ack with the result of each frame sent.
+ *
+ * @param p_enc   Pointer to encoder.
+ * @param samples Samples to be encoded.
+ * @param buff    Pointer to a buffer where the frame should be written.
+ * @param len     Size of the buffer.
+ * @param p_size  Pointer to store the frame size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_BUFFER_TOO_SMALL The encoded frame does not fit the buffer.
+ */
+rf24_status_t rf24_codec_encode(rf24_codec_encoder_t* p_enc, const int32_t* samples, uint8_t* buff, uint8_t len,
+                                uint8_t* p_size);
+
+/**
+ * @brief Informs whether the last frame encoded reached the receiver.
+ *
+ * @note Deltas keep referencing the last frame delivered, and keyframes are
+ *       sent once the decoder no longer keeps it.
+ *
+ * @param p_enc     Pointer to encoder.
+ * @param delivered Whether the frame was acknowledged.
+ */
+void rf24_codec_ack(rf24_codec_encoder_t* p_enc, bool delivered);
+
+/**
+ * @brief Encodes a frame and sends it with auto acknowledgement.
+ *
+ * @param p_enc   Pointer to encoder.
+ * @param p_dev   Pointer to rf24 device.
+ * @param samples Samples to be sent.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_codec_write(rf24_codec_encoder_t* p_enc, rf24_dev_t* p_dev, const int32_t* samples);
+
+/**
+ * @brief Initializes a decoder, waiting for a keyframe.
+ *
+ * @param p_dec          Pointer to decoder.
+ * @param num_of_samples Samples per frame, up to @ref RF24_CODEC_MAX_SAMPLES.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_codec_decoder_init(rf24_codec_decoder_t* p_dec, uint8_t num_of_samples);
+
+/**
+ * @brief Decodes a received frame.
+ *
+ * @note Payloads from @ref rf24_read_next go to the decoder of their pipe.
+ *
+ * @param p_dec   Pointer to decoder.
+ * @param buff    Pointer to the received frame.
+ * @param size    Frame size.
+ * @param samples Pointer to store the samples.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_OUT_OF_SYNC        The delta reference is unknown, waiting for a keyframe.
+ * @retval RF24_INVALID_PARAMETERS The frame is malformed.
+ */
+rf24_status_t rf24_codec_decode(rf24_codec_decoder_t* p_dec, const uint8_t* buff, uint8_t size, int32_t* samples);
+
+#endif // __RF24_CODEC_H__
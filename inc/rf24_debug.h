@@ -35,4 +35,21 @@ void rf24_debug_dump_registers(rf24_dev_t* p_dev);
  */
 void rf24_debug_print_status(rf24_dev_t* p_dev);
 
+/**
+ * @brief Print an operation histogram summary and its non empty buckets.
+ *
+ * @param op Measured operation, a @ref rf24_histogram_op_t.
+ */
+void rf24_debug_print_histogram(uint8_t op);
+
+/**
+ * @brief Print the time taken to seal and to open a full payload.
+ *
+ * @note @ref rf24_get_time_us must be implemented, the cycles per packet
+ *       are the time multiplied by the core clock.
+ *
+ * @param iterations Number of payloads measured.
+ */
+void rf24_debug_print_aead_benchmark(uint16_t iterations);
+
 #endif // __RF24_DEBUG_H__
@@ -0,0 +1,100 @@
+/**
+ * @file rf24_deferred.h
+ *
+ * @brief nRF24L01 deferred interruption handling, with a lock free queue between the ISR and a worker.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_DEFERRED_H__
+#define __RF24_DEFERRED_H__
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+/**
+ * @brief Number of IRQ edges that may wait for the worker, must be a power of 2.
+ */
+#ifndef RF24_DEFERRED_QUEUE_SIZE
+#define RF24_DEFERRED_QUEUE_SIZE 8
+#endif
+
+#if (RF24_DEFERRED_QUEUE_SIZE & (RF24_DEFERRED_QUEUE_SIZE - 1)) != 0
+#error "RF24_DEFERRED_QUEUE_SIZE must be a power of 2"
+#endif
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Deferred interruption handler type.
+ *
+ * @note The queue has a single producer, the ISR, and a single consumer,
+ *       the worker. Each index is only written by its owner.
+ */
+typedef struct rf24_deferred {
+    rf24_dev_t*      p_dev;
+
+    uint32_t         edges_us[RF24_DEFERRED_QUEUE_SIZE];  /**< Time of each queued IRQ edge. */
+    _Atomic uint32_t head;                                /**< Next position written by the ISR. */
+    _Atomic uint32_t tail;                                /**< Next position read by the worker. */
+
+    uint32_t         overflows;                           /**< Edges dropped with the queue full, written by the ISR. */
+    uint32_t         edge_us;                             /**< Time of the edge being processed. */
+} rf24_deferred_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a deferred interruption handler, with an empty queue.
+ *
+ * @param p_def Pointer to deferred handler.
+ * @param p_dev Pointer to rf24 device.
+ */
+void rf24_deferred_init(rf24_deferred_t* p_def, rf24_dev_t* p_dev);
+
+/**
+ * @brief Queues an IRQ edge, to be called from the IRQ pin ISR.
+ *
+ * @note No SPI transfer is done, only the edge time is taken with
+ *       @ref rf24_get_time_us. With the queue full the edge is dropped,
+ *       the next processed one still gets every pending flag.
+ *
+ * @param p_def Pointer to deferred handler.
+ */
+void rf24_deferred_isr(rf24_deferred_t* p_def);
+
+/**
+ * @brief Handles the oldest queued IRQ edge, to be called from the worker.
+ *
+ * @note Calls @ref rf24_irq_callback, dispatching the device callbacks.
+ *       The edge time is in edge_us while they run, and is used for the
+ *       device event timestamps.
+ *
+ * @param p_def Pointer to deferred handler.
+ * @param p_irq Pointer to store the interruption flags, may be NULL.
+ *
+ * @return Whether an edge was handled.
+ */
+bool rf24_deferred_process(rf24_deferred_t* p_def, rf24_irq_t* p_irq);
+
+/**
+ * @brief Gets the number of queued IRQ edges.
+ *
+ * @param p_def Pointer to deferred handler.
+ *
+ * @return Number of queued IRQ edges.
+ */
+uint32_t rf24_deferred_pending(rf24_deferred_t* p_def);
+
+#endif // __RF24_DEFERRED_H__
@@ -0,0 +1,132 @@
+/**
+ * @file rf24_failsafe.h
+ *
+ * @brief nRF24L01 link loss detector, with per pipe deadlines.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_FAILSAFE_H__
+#define __RF24_FAILSAFE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+/**
+ * @brief Source reported by the callback for the transmitter link.
+ */
+#define RF24_FAILSAFE_TX RF24_NUM_OF_PIPES
+
+/**
+ * @brief Returned by @ref rf24_failsafe_check when no deadline is pending.
+ */
+#define RF24_FAILSAFE_NO_DEADLINE UINT32_MAX
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Link state change callback type.
+ *
+ * @param p_context Context given on @ref rf24_failsafe_init.
+ * @param source    Pipe whose deadline passed or @ref RF24_FAILSAFE_TX.
+ * @param lost      Whether the link was lost or recovered.
+ */
+typedef void (*rf24_failsafe_callback_t)(void* p_context, uint8_t source, bool lost);
+
+/**
+ * @brief Failsafe type.
+ */
+typedef struct rf24_failsafe {
+    rf24_dev_t*              p_dev;
+    rf24_failsafe_callback_t callback;
+    void*                    p_context;
+
+    uint32_t                 deadline_us[RF24_NUM_OF_PIPES];   /**< Max time without traffic, 0 disables the pipe. */
+    uint32_t                 last_rx_us[RF24_NUM_OF_PIPES];    /**< Time of the last payload, or of the watch start. */
+    uint32_t                 rx_count[RF24_NUM_OF_PIPES];      /**< Device count seen on the last check. */
+    uint8_t                  lost_pipes;                       /**< One bit per pipe whose link is lost. */
+
+    uint8_t                  max_rt_limit;                     /**< Failed transmissions in a row, 0 disables it. */
+    bool                     tx_lost;
+} rf24_failsafe_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a failsafe, with no pipe watched.
+ *
+ * @param p_fs      Pointer to failsafe.
+ * @param p_dev     Pointer to rf24 device.
+ * @param callback  Function called when a link is lost or recovered.
+ * @param p_context Pointer given back to the callback.
+ */
+void rf24_failsafe_init(rf24_failsafe_t* p_fs, rf24_dev_t* p_dev, rf24_failsafe_callback_t callback, void* p_context);
+
+/**
+ * @brief Sets the max time without traffic on a pipe, starting now.
+ *
+ * @param p_fs        Pointer to failsafe.
+ * @param pipe_number Number of the pipe, from 0 to 5.
+ * @param deadline_us Max time without traffic, 0 stops watching the pipe.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_failsafe_watch_pipe(rf24_failsafe_t* p_fs, uint8_t pipe_number, uint32_t deadline_us);
+
+/**
+ * @brief Sets the number of transmissions failed in a row that loses the transmitter link.
+ *
+ * @param p_fs         Pointer to failsafe.
+ * @param max_rt_limit Failed transmissions in a row, 0 stops watching the transmitter.
+ */
+void rf24_failsafe_watch_tx(rf24_failsafe_t* p_fs, uint8_t max_rt_limit);
+
+/**
+ * @brief Checks the deadlines, calling the callback on each link state change.
+ *
+ * @note Payloads are tracked by the device read functions, with the time
+ *       stamped by @ref rf24_irq_callback when they arrived, and transmission
+ *       results by the write functions and @ref rf24_irq_callback.
+ *
+ * @note Call it from a timer programmed with the returned time, or
+ *       periodically, and after the device IRQ is handled.
+ *
+ * @note @ref rf24_get_time_us must be implemented.
+ *
+ * @param p_fs Pointer to failsafe.
+ *
+ * @return Time until the next deadline in microseconds, or @ref RF24_FAILSAFE_NO_DEADLINE.
+ */
+uint32_t rf24_failsafe_check(rf24_failsafe_t* p_fs);
+
+/**
+ * @brief Handles the device IRQ and checks the deadlines.
+ *
+ * @note Replaces @ref rf24_irq_callback in the IRQ handler.
+ *
+ * @param p_fs Pointer to failsafe.
+ *
+ * @return Interruption flags, see @ref rf24_irq_callback.
+ */
+rf24_irq_t rf24_failsafe_irq_callback(rf24_failsafe_t* p_fs);
+
+/**
+ * @brief Gets whether any watched link is lost.
+ *
+ * @param p_fs Pointer to failsafe.
+ *
+ * @return Whether any watched link is lost.
+ */
+bool rf24_failsafe_is_lost(rf24_failsafe_t* p_fs);
+
+#endif // __RF24_FAILSAFE_H__
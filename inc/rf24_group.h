@@ -0,0 +1,169 @@
+/**
+ * @file rf24_group.h
+ *
+ * @brief nRF24L01 group addressing, for more nodes than receiver pipes.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_GROUP_H__
+#define __RF24_GROUP_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#define RF24_GROUP_HEADER_SIZE 1
+#define RF24_GROUP_MAX_NODES 256
+
+#ifndef RF24_GROUP_MAX_DEDICATED_NODES
+#define RF24_GROUP_MAX_DEDICATED_NODES 16
+#endif
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Node with a dedicated address, for hardware acknowledgements.
+ */
+typedef struct rf24_group_dedicated {
+    uint8_t node_id;
+    uint8_t address_lsb;  /**< Address LSB, the other bytes are the group address ones. */
+} rf24_group_dedicated_t;
+
+/**
+ * @brief Group addressing type.
+ *
+ * @note All nodes send to the group address, on pipe 1 of the receiver, with
+ *       their node ID as the first payload byte. Nodes needing hardware
+ *       acknowledgements get a dedicated address, differing from the group
+ *       one on the LSB, and share pipes 2 to 5 in turns.
+ */
+typedef struct rf24_group {
+    rf24_dev_t*            p_dev;
+    uint8_t                node_id;
+    uint8_t                group_address[RF24_ADDRESS_MAX_SIZE];
+
+    uint8_t                filter[RF24_GROUP_MAX_NODES / 8];  /**< Bitmap of the node IDs accepted. */
+
+    rf24_group_dedicated_t dedicated[RF24_GROUP_MAX_DEDICATED_NODES];
+    uint8_t                num_of_dedicated;
+    uint8_t                next_dedicated;      /**< First dedicated node of the next turn. */
+    uint32_t               turn_us;             /**< Time each turn of dedicated nodes stays on the pipes. */
+    uint32_t               turn_start_us;
+
+    uint32_t               filtered;            /**< Payloads dropped by the node ID filter. */
+} rf24_group_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes group addressing, accepting no node.
+ *
+ * @param p_group       Pointer to group.
+ * @param p_dev         Pointer to rf24 device.
+ * @param node_id       Own node ID, sent on the header.
+ * @param group_address Address shared by the group.
+ */
+void rf24_group_init(rf24_group_t* p_group, rf24_dev_t* p_dev, uint8_t node_id, uint8_t* group_address);
+
+/**
+ * @brief Opens the group address for reading, on pipe 1.
+ *
+ * @param p_group         Pointer to group.
+ * @param enable_auto_ack Whether the group pipe acknowledges packets, only
+ *                        safe with a single receiver on the group address.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_group_open_receiver(rf24_group_t* p_group, bool enable_auto_ack);
+
+/**
+ * @brief Opens the address the node sends to.
+ *
+ * @param p_group     Pointer to group.
+ * @param address_lsb Dedicated address LSB, or the group address LSB to
+ *                    send to the group pipe.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_group_open_transmitter(rf24_group_t* p_group, uint8_t address_lsb);
+
+/**
+ * @brief Accepts or rejects payloads from a node.
+ *
+ * @param p_group Pointer to group.
+ * @param node_id Node ID.
+ * @param accept  Whether payloads from the node are accepted or not.
+ */
+void rf24_group_accept(rf24_group_t* p_group, uint8_t node_id, bool accept);
+
+/**
+ * @brief Adds a node with a dedicated address, also accepting it.
+ *
+ * @note Up to four dedicated nodes stay on pipes 2 to 5. With more, they
+ *       take turns of turn_us each, so a node must keep retrying for the
+ *       whole rotation to be sure of its turn.
+ *
+ * @param p_group     Pointer to group.
+ * @param node_id     Node ID.
+ * @param address_lsb Dedicated address LSB, different from the group one.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_group_add_dedicated(rf24_group_t* p_group, uint8_t node_id, uint8_t address_lsb);
+
+/**
+ * @brief Sets the time each turn of dedicated nodes stays on pipes 2 to 5.
+ *
+ * @param p_group Pointer to group.
+ * @param turn_us Turn time in microseconds.
+ */
+void rf24_group_set_turn_time(rf24_group_t* p_group, uint32_t turn_us);
+
+/**
+ * @brief Updates the dedicated nodes on pipes 2 to 5.
+ *
+ * @note This function should be called periodically when using more than
+ *       four dedicated nodes. @ref rf24_get_time_us must be implemented.
+ *
+ * @param p_group Pointer to group.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_group_update(rf24_group_t* p_group);
+
+/**
+ * @brief Sends data with the node ID header.
+ *
+ * @param p_group         Pointer to group.
+ * @param buff            Pointer to the data to be sent.
+ * @param len             Number of bytes to be sent, up to the payload size minus the header.
+ * @param enable_auto_ack Whether an acknowledgement is expected.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_group_write(rf24_group_t* p_group, uint8_t* buff, uint8_t len, bool enable_auto_ack);
+
+/**
+ * @brief Reads the next payload from an accepted node, without the header.
+ *
+ * @param p_group   Pointer to group.
+ * @param buff      Pointer to a buffer where the data should be written.
+ * @param len       Size of the buffer.
+ * @param p_node_id Pointer to store the node ID.
+ * @param p_size    Pointer to store the data size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY No payload from an accepted node.
+ */
+rf24_status_t rf24_group_read(rf24_group_t* p_group, uint8_t* buff, uint8_t len, uint8_t* p_node_id, uint8_t* p_size);
+
+#endif // __RF24_GROUP_H__
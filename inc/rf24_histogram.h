@@ -0,0 +1,158 @@
+/**
+ * @file rf24_histogram.h
+ *
+ * @brief nRF24L01 operation latency histograms, with fixed memory log-linear buckets.
+ *
+ * @note Recording from the driver is only compiled with RF24_HISTOGRAM defined.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_HISTOGRAM_H__
+#define __RF24_HISTOGRAM_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+/**
+ * @brief Bits of linear sub-buckets in each power of 2, the relative error is 2^-bits.
+ */
+#ifndef RF24_HISTOGRAM_SUB_BITS
+#define RF24_HISTOGRAM_SUB_BITS 2
+#endif
+
+/**
+ * @brief Values from 2^bits microseconds on go to the overflow bucket.
+ */
+#ifndef RF24_HISTOGRAM_MAX_BITS
+#define RF24_HISTOGRAM_MAX_BITS 20
+#endif
+
+#define RF24_HISTOGRAM_SUB_BUCKETS (1U << RF24_HISTOGRAM_SUB_BITS)
+
+/**
+ * @brief Number of buckets, the last one holds the overflows.
+ */
+#define RF24_HISTOGRAM_NUM_OF_BUCKETS \
+    ((RF24_HISTOGRAM_MAX_BITS - RF24_HISTOGRAM_SUB_BITS + 1) * RF24_HISTOGRAM_SUB_BUCKETS + 1)
+
+#if RF24_HISTOGRAM_NUM_OF_BUCKETS > 256
+#error "RF24_HISTOGRAM_NUM_OF_BUCKETS must fit the one byte bucket index of the export format"
+#endif
+
+/**
+ * @brief Export header size, see @ref rf24_histogram_export.
+ */
+#define RF24_HISTOGRAM_EXPORT_HEADER_SIZE 14
+
+/*****************************************
+ * Public Macros
+ *****************************************/
+
+#ifdef RF24_HISTOGRAM
+#define RF24_HISTOGRAM_START(start_us) uint32_t start_us = rf24_get_time_us()
+#define RF24_HISTOGRAM_RECORD(op, start_us) rf24_histogram_record((op), rf24_get_time_us() - (start_us))
+#else
+#define RF24_HISTOGRAM_START(start_us)
+#define RF24_HISTOGRAM_RECORD(op, start_us)
+#endif
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Measured operations.
+ */
+typedef enum rf24_histogram_op {
+    RF24_HISTOGRAM_WRITE = 0,          /**< @ref rf24_write, from the payload load to TX_DS or MAX_RT. */
+    RF24_HISTOGRAM_RX_LATENCY,         /**< Receiver interruption to payload read. */
+    RF24_HISTOGRAM_START_LISTENING,    /**< @ref rf24_start_listening turnaround. */
+    RF24_HISTOGRAM_STOP_LISTENING,     /**< @ref rf24_stop_listening turnaround. */
+    RF24_HISTOGRAM_SPI,                /**< Each SPI transaction. */
+    RF24_NUM_OF_HISTOGRAMS,
+} rf24_histogram_op_t;
+
+/**
+ * @brief Histogram type, values in microseconds.
+ */
+typedef struct rf24_histogram {
+    uint32_t counts[RF24_HISTOGRAM_NUM_OF_BUCKETS];
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+} rf24_histogram_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Records the duration of an operation.
+ *
+ * @note Called by the driver when RF24_HISTOGRAM is defined, the
+ *       histograms are shared by all devices.
+ *
+ * @param op       Measured operation.
+ * @param value_us Duration in microseconds.
+ */
+void rf24_histogram_record(rf24_histogram_op_t op, uint32_t value_us);
+
+/**
+ * @brief Copies the histogram of an operation.
+ *
+ * @note Records made from interruptions during the copy may be partially
+ *       included.
+ *
+ * @param op         Measured operation.
+ * @param p_snapshot Pointer to store the copy.
+ */
+void rf24_histogram_snapshot(rf24_histogram_op_t op, rf24_histogram_t* p_snapshot);
+
+/**
+ * @brief Clears the histograms of all operations.
+ */
+void rf24_histogram_reset(void);
+
+/**
+ * @brief Gets the value under which a percentage of the records are.
+ *
+ * @param p_hist  Pointer to histogram.
+ * @param percent Percentage, from 0 to 100.
+ *
+ * @return Upper bound of the bucket reaching the percentage, in microseconds.
+ */
+uint32_t rf24_histogram_percentile(const rf24_histogram_t* p_hist, uint8_t percent);
+
+/**
+ * @brief Gets the smallest value of a bucket.
+ *
+ * @param bucket Bucket index.
+ *
+ * @return Smallest value of the bucket, in microseconds.
+ */
+uint32_t rf24_histogram_bucket_min_us(uint16_t bucket);
+
+/**
+ * @brief Writes a histogram in a compact binary format.
+ *
+ * @note The format is the sub bits and max bits bytes, followed by the
+ *       count, min and max as 32 bits little endian, then one entry per
+ *       non empty bucket: its index as one byte and its count as a LEB128
+ *       varint.
+ *
+ * @param p_hist Pointer to histogram.
+ * @param buff   Pointer to a buffer where the data should be written.
+ * @param len    Size of the buffer.
+ *
+ * @return Number of bytes written, 0 when the buffer is too small.
+ */
+uint16_t rf24_histogram_export(const rf24_histogram_t* p_hist, uint8_t* buff, uint16_t len);
+
+#endif // __RF24_HISTOGRAM_H__
@@ -0,0 +1,129 @@
+/**
+ * @file rf24_hub.h
+ *
+ * @brief nRF24L01 star network hub, with per pipe queues and fair servicing.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_HUB_H__
+#define __RF24_HUB_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#ifndef RF24_HUB_QUEUE_SIZE
+#define RF24_HUB_QUEUE_SIZE 4
+#endif
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Per pipe receive queue type.
+ */
+typedef struct rf24_hub_queue {
+    uint8_t  data[RF24_HUB_QUEUE_SIZE][RF24_MAX_PAYLOAD_SIZE];
+    uint8_t  size[RF24_HUB_QUEUE_SIZE];
+    uint8_t  head;
+    uint8_t  count;
+
+    uint8_t  weight;    /**< Payloads served in a row before moving to the next pipe. */
+
+    uint32_t received;  /**< Payloads queued. */
+    uint32_t dropped;   /**< Payloads dropped because the queue was full. */
+} rf24_hub_queue_t;
+
+/**
+ * @brief Hub type.
+ */
+typedef struct rf24_hub {
+    rf24_dev_t*      p_dev;
+    rf24_hub_queue_t queues[RF24_NUM_OF_PIPES];
+
+    uint8_t          current_pipe;  /**< Pipe being served. */
+    uint8_t          credits;       /**< Payloads left to serve from the current pipe. */
+} rf24_hub_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a hub, with all weights set to 1 (round robin).
+ *
+ * @param p_hub Pointer to hub.
+ * @param p_dev Pointer to rf24 device.
+ */
+void rf24_hub_init(rf24_hub_t* p_hub, rf24_dev_t* p_dev);
+
+/**
+ * @brief Opens a hub pipe with its own payload size.
+ *
+ * @param p_hub        Pointer to hub.
+ * @param pipe_number  Number of the pipe.
+ * @param address      Pipe address, only the first byte is used on pipes 2 to 5.
+ * @param payload_size Static payload size, 0 to use the device payload size.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_hub_open_pipe(rf24_hub_t* p_hub, uint8_t pipe_number, uint8_t* address, uint8_t payload_size);
+
+/**
+ * @brief Sets the share of a pipe, how many payloads are served in a row from it.
+ *
+ * @param p_hub       Pointer to hub.
+ * @param pipe_number Number of the pipe.
+ * @param weight      Pipe weight, at least 1.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_hub_set_weight(rf24_hub_t* p_hub, uint8_t pipe_number, uint8_t weight);
+
+/**
+ * @brief Moves all payloads in the receiver FIFO to the pipe queues.
+ *
+ * @note Payloads arriving at a full queue are dropped and counted, so
+ *       the hardware FIFO is always drained and other pipes keep receiving.
+ *
+ * @param p_hub Pointer to hub.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_hub_poll(rf24_hub_t* p_hub);
+
+/**
+ * @brief Reads the next payload, servicing the pipes by their weights.
+ *
+ * @param p_hub  Pointer to hub.
+ * @param buff   Pointer to a buffer where the data should be written.
+ * @param len    Size of the buffer.
+ * @param p_pipe Pointer to store the pipe the payload came from.
+ * @param p_size Pointer to store the payload size.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY All queues are empty.
+ */
+rf24_status_t rf24_hub_read(rf24_hub_t* p_hub, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size);
+
+/**
+ * @brief Queues a reply to be sent with the next acknowledgement of a pipe.
+ *
+ * @note ACK payloads must be enabled, see @ref rf24_enable_ack_payload.
+ *
+ * @param p_hub       Pointer to hub.
+ * @param pipe_number Number of the pipe.
+ * @param buff        Pointer to the data to be sent.
+ * @param len         Number of bytes to be sent.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_hub_reply(rf24_hub_t* p_hub, uint8_t pipe_number, uint8_t* buff, uint8_t len);
+
+#endif // __RF24_HUB_H__
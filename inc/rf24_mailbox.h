@@ -0,0 +1,94 @@
+/**
+ * @file rf24_mailbox.h
+ *
+ * @brief nRF24L01 latest value receiver, keeping only the newest payload per pipe.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_MAILBOX_H__
+#define __RF24_MAILBOX_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Mailbox slot type, the newest payload of a pipe.
+ *
+ * @note The slot is protected by a sequence lock: the sequence is odd while
+ *       the payload is being written, so readers retry instead of locking.
+ */
+typedef struct rf24_mailbox_slot {
+    volatile uint32_t seq;
+    uint8_t           data[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t           size;
+    uint32_t          timestamp_us;  /**< Arrival time, see @ref rf24_get_rx_timestamp_us. */
+    volatile bool     unread;        /**< Set by the update, cleared by the read. */
+} rf24_mailbox_slot_t;
+
+/**
+ * @brief Mailbox type.
+ */
+typedef struct rf24_mailbox {
+    rf24_dev_t*         p_dev;
+    rf24_mailbox_slot_t slots[RF24_NUM_OF_PIPES];
+
+    uint32_t            received;
+    uint32_t            overwritten;  /**< Payloads replaced before being read. */
+} rf24_mailbox_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a mailbox, with all slots empty.
+ *
+ * @param p_mb  Pointer to mailbox.
+ * @param p_dev Pointer to rf24 device.
+ */
+void rf24_mailbox_init(rf24_mailbox_t* p_mb, rf24_dev_t* p_dev);
+
+/**
+ * @brief Drains the receiver FIFO, keeping the newest payload of each pipe.
+ *
+ * @note This function should be called from the IRQ handler or periodically,
+ *       and must not be preempted by another call to it.
+ *
+ * @note @ref rf24_get_time_us should be implemented for the timestamps.
+ *
+ * @param p_mb Pointer to mailbox.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_mailbox_update(rf24_mailbox_t* p_mb);
+
+/**
+ * @brief Reads the newest payload of a pipe, without any SPI transfer.
+ *
+ * @note Reading does not empty the slot, the same payload is returned
+ *       until a newer one arrives. Compare the timestamps to tell them apart.
+ *
+ * @note Must not be called from a context that preempts @ref rf24_mailbox_update,
+ *       the read would spin on the slot being written.
+ *
+ * @param p_mb           Pointer to mailbox.
+ * @param pipe_number    Number of the pipe, from 0 to 5.
+ * @param buff           Pointer to a buffer where the data should be written.
+ * @param len            Size of the buffer.
+ * @param p_size         Pointer to store the data size.
+ * @param p_timestamp_us Pointer to store the payload timestamp, may be NULL.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY Nothing received on the pipe yet.
+ */
+rf24_status_t rf24_mailbox_read(rf24_mailbox_t* p_mb, uint8_t pipe_number, uint8_t* buff, uint8_t len,
+                                uint8_t* p_size, uint32_t* p_timestamp_us);
+
+#endif // __RF24_MAILBOX_H__
@@ -0,0 +1,215 @@
+/**
+ * @file rf24_network.h
+ *
+ * @brief nRF24L01 tree network layer, with multi hop routing.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_NETWORK_H__
+#define __RF24_NETWORK_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#define RF24_NETWORK_HEADER_SIZE 6
+#define RF24_NETWORK_MAX_PAYLOAD_SIZE (RF24_MAX_PAYLOAD_SIZE - RF24_NETWORK_HEADER_SIZE)
+
+/**
+ * @brief Max depth of the tree, each level is one octal digit of the node address.
+ */
+#define RF24_NETWORK_MAX_LEVELS 4
+
+/**
+ * @brief Max children of a node, one per reading pipe besides pipe 0.
+ */
+#define RF24_NETWORK_MAX_CHILDREN 5
+
+#ifndef RF24_NETWORK_QUEUE_SIZE
+#define RF24_NETWORK_QUEUE_SIZE 4
+#endif
+
+#ifndef RF24_NETWORK_MAX_ROUTES
+#define RF24_NETWORK_MAX_ROUTES 8
+#endif
+
+#ifndef RF24_NETWORK_DUPLICATES_SIZE
+#define RF24_NETWORK_DUPLICATES_SIZE 8
+#endif
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Network frame header type.
+ *
+ * @note Node addresses are octal, with one digit from 1 to 5 per level
+ *       starting at the least significant one: 0 is the root, 02 its
+ *       second child and 032 the third child of 02.
+ */
+typedef struct rf24_network_header {
+    uint16_t from;
+    uint16_t to;
+    uint8_t  id;    /**< Frame identifier, sequential per sender. */
+    uint8_t  type;  /**< Application defined frame type. */
+} rf24_network_header_t;
+
+/**
+ * @brief Network frame type.
+ */
+typedef struct rf24_network_frame {
+    rf24_network_header_t header;
+    uint8_t               data[RF24_NETWORK_MAX_PAYLOAD_SIZE];
+    uint8_t               size;
+} rf24_network_frame_t;
+
+/**
+ * @brief Network frame queue type.
+ */
+typedef struct rf24_network_queue {
+    rf24_network_frame_t frames[RF24_NETWORK_QUEUE_SIZE];
+    uint8_t              head;
+    uint8_t              count;
+} rf24_network_queue_t;
+
+/**
+ * @brief Static route type.
+ */
+typedef struct rf24_network_route {
+    uint16_t to;
+    uint16_t next_hop;  /**< Parent or child of this node to forward to. */
+} rf24_network_route_t;
+
+/**
+ * @brief Network statistics type.
+ */
+typedef struct rf24_network_stats {
+    uint32_t sent;
+    uint32_t send_failures;
+    uint32_t forwarded;
+    uint32_t forward_failures;
+    uint32_t delivered;
+    uint32_t duplicates;
+    uint32_t queue_drops;
+    uint32_t unroutable;  /**< Frames received for an invalid address, or with no next hop. */
+} rf24_network_stats_t;
+
+/**
+ * @brief Network node type.
+ */
+typedef struct rf24_network {
+    rf24_dev_t*          p_dev;
+    uint16_t             node_address;
+    uint8_t              network_id[2];  /**< Address bytes shared by the whole network. */
+
+    rf24_network_queue_t rx_queue;       /**< Frames addressed to this node. */
+    rf24_network_queue_t forward_queue;  /**< Frames waiting to be forwarded. */
+
+    rf24_network_route_t routes[RF24_NETWORK_MAX_ROUTES];
+    uint8_t              num_of_routes;
+
+    rf24_network_header_t duplicates[RF24_NETWORK_DUPLICATES_SIZE];  /**< Last frames received. */
+    uint8_t              duplicates_head;
+
+    uint8_t              next_id;
+
+    rf24_network_stats_t stats;
+} rf24_network_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a network node, opening its reading pipes and listening.
+ *
+ * @note The node listens to its parent on pipe 0 and to each child on the
+ *       pipe of the child last digit. Pipe addresses are built from the pipe,
+ *       the node address and the network identifier.
+ *
+ * @param p_net        Pointer to network node.
+ * @param p_dev        Pointer to rf24 device.
+ * @param node_address Octal node address.
+ * @param network_id   Identifier shared by the network, two bytes.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_network_init(rf24_network_t* p_net, rf24_dev_t* p_dev, uint16_t node_address, uint8_t* network_id);
+
+/**
+ * @brief Adds a static route, overriding the tree route to a node.
+ *
+ * @param p_net    Pointer to network node.
+ * @param to       Destination node address.
+ * @param next_hop Parent or child of this node to forward to.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_INVALID_PARAMETERS The table is full, the destination is not valid or the next hop is not a neighbor.
+ */
+rf24_status_t rf24_network_add_route(rf24_network_t* p_net, uint16_t to, uint16_t next_hop);
+
+/**
+ * @brief Receives the frames in the receiver FIFO and forwards the queued ones.
+ *
+ * @note Frames to the same next hop are loaded together in the transmitter
+ *       FIFO and sent back to back.
+ *
+ * @note This function should be called periodically.
+ *
+ * @param p_net Pointer to network node.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_network_update(rf24_network_t* p_net);
+
+/**
+ * @brief Sends data to a node, through the next hop.
+ *
+ * @param p_net Pointer to network node.
+ * @param to    Destination node address.
+ * @param type  Application defined frame type.
+ * @param buff  Pointer to the data to be sent.
+ * @param len   Number of bytes to be sent, up to @ref RF24_NETWORK_MAX_PAYLOAD_SIZE.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_INVALID_PARAMETERS The payload is too long, or the destination is not a valid node address.
+ */
+rf24_status_t rf24_network_write(rf24_network_t* p_net, uint16_t to, uint8_t type, uint8_t* buff, uint8_t len);
+
+/**
+ * @brief Reads the next frame addressed to this node.
+ *
+ * @param p_net   Pointer to network node.
+ * @param p_frame Pointer to store the frame.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_RX_FIFO_EMPTY No frame available.
+ */
+rf24_status_t rf24_network_read(rf24_network_t* p_net, rf24_network_frame_t* p_frame);
+
+/**
+ * @brief Gets the parent of a node.
+ *
+ * @param node_address Octal node address.
+ *
+ * @return Parent node address, the root is its own parent.
+ */
+uint16_t rf24_network_parent(uint16_t node_address);
+
+/**
+ * @brief Gets the next hop from a node to another.
+ *
+ * @param p_net Pointer to network node.
+ * @param to    Destination node address.
+ *
+ * @return Next hop node address.
+ */
+uint16_t rf24_network_next_hop(rf24_network_t* p_net, uint16_t to);
+
+#endif // __RF24_NETWORK_H__
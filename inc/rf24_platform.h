@@ -81,6 +81,17 @@ rf24_platform_status_t rf24_platform_enable(rf24_platform_t* p_setup);
  */
 rf24_platform_status_t rf24_platform_disable(rf24_platform_t* p_setup);
 
+/**
+ * @brief Gets whether the IRQ pin is asserted.
+ *
+ * @note The IRQ pin is active low.
+ *
+ * @param p_setup Pointer to rf24 instance setup.
+ *
+ * @return Whether any unmasked interruption is pending.
+ */
+bool rf24_platform_irq_asserted(rf24_platform_t* p_setup);
+
 /**
  * @brief Send SPI command.
  *
@@ -178,4 +189,29 @@ rf24_platform_status_t rf24_platform_read_payload(rf24_platform_t* p_setup, uint
 rf24_platform_status_t rf24_platform_write_payload(rf24_platform_t* p_setup, uint8_t* buff, uint8_t len,
                                                    bool enable_auto_ack);
 
+/**
+ * @brief Write payload to be sent with the next acknowledgement of a pipe.
+ *
+ * @param p_setup Pointer to rf24 instance setup.
+ * @param pipe_number Number of the pipe
+ * @param buff Buffer with the payload data
+ * @param len Payload lenght
+ *
+ * @note The EN_ACK_PAY and EN_DPL bits from the FEATURE register must be set.
+ *
+ * @return @ref rf24_platform_status.
+ */
+rf24_platform_status_t rf24_platform_write_ack_payload(rf24_platform_t* p_setup, uint8_t pipe_number, uint8_t* buff,
+                                                       uint8_t len);
+
+/**
+ * @brief Read the width of the payload on top of the device Rx FIFO.
+ *
+ * @param p_setup Pointer to rf24 instance setup.
+ * @param p_width Pointer to store the payload width
+ *
+ * @return @ref rf24_platform_status.
+ */
+rf24_platform_status_t rf24_platform_read_payload_width(rf24_platform_t* p_setup, uint8_t* p_width);
+
 #endif // __RF24_PLATFORM_H__
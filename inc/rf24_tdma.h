@@ -0,0 +1,161 @@
+/**
+ * @file rf24_tdma.h
+ *
+ * @brief nRF24L01 beacon synchronized time division multiple access related.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_TDMA_H__
+#define __RF24_TDMA_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#define RF24_TDMA_MAX_SLOTS 16
+#define RF24_TDMA_BEACON_HEADER_SIZE 12
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief TDMA role type.
+ */
+typedef enum rf24_tdma_role {
+    RF24_TDMA_BASE = 0, /**< Sends the beacons and receives on all slots. */
+    RF24_TDMA_NODE,     /**< Follows the beacons and transmits on its own slots. */
+} rf24_tdma_role_t;
+
+/**
+ * @brief TDMA configuration type.
+ *
+ * @note The number of slots, the slot map and the guard time are only used
+ *       by the base, nodes take them from the beacons.
+ */
+typedef struct rf24_tdma_config {
+    rf24_tdma_role_t role;
+    uint8_t          node_id;                        /**< Node identifier, matched against the slot map. */
+
+    uint8_t          num_of_slots;
+    uint8_t          slot_map[RF24_TDMA_MAX_SLOTS];  /**< Node identifier owning each slot. */
+    uint16_t         guard_us;                       /**< Max clock error between base and nodes. */
+
+    uint8_t*         beacon_address;                 /**< Address the beacons are sent to. */
+    uint8_t*         base_address;                   /**< Address the nodes send data to. */
+} rf24_tdma_config_t;
+
+/**
+ * @brief TDMA statistics type.
+ */
+typedef struct rf24_tdma_stats {
+    uint32_t beacons_sent;
+    uint32_t beacons_received;
+    uint32_t beacons_missed;
+    uint32_t sync_losses;
+} rf24_tdma_stats_t;
+
+/**
+ * @brief TDMA instance type.
+ */
+typedef struct rf24_tdma {
+    rf24_dev_t*        p_dev;
+    rf24_tdma_role_t   role;
+    uint8_t            node_id;
+
+    uint8_t            num_of_slots;
+    uint8_t            slot_map[RF24_TDMA_MAX_SLOTS];
+    uint16_t           guard_us;
+
+    uint32_t           slot_us;           /**< Data slot length. */
+    uint32_t           beacon_slot_us;    /**< Beacon slot length, at the start of each superframe. */
+    uint32_t           superframe_us;     /**< Beacon slot plus all data slots. */
+
+    bool               synced;
+    bool               listening;
+    uint8_t            missed_beacons;
+    uint32_t           superframe_start_us;  /**< Local time the current superframe started. */
+    int32_t            clock_offset_us;      /**< Base time minus local time. */
+
+    rf24_tdma_stats_t  stats;
+} rf24_tdma_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a TDMA base or node, opening its pipes.
+ *
+ * @note Data slots fit the worst case airtime of a payload, see
+ *       @ref rf24_worst_case_airtime_us, so fewer retransmissions give
+ *       shorter slots. Beacons and data share the device payload size,
+ *       which must fit the beacon header plus the slot map.
+ *
+ * @note @ref rf24_get_time_us must be implemented by the user.
+ *
+ * @param p_tdma   Pointer to TDMA instance.
+ * @param p_dev    Pointer to rf24 device.
+ * @param p_config Pointer to TDMA configuration.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_tdma_init(rf24_tdma_t* p_tdma, rf24_dev_t* p_dev, rf24_tdma_config_t* p_config);
+
+/**
+ * @brief Updates the TDMA schedule.
+ *
+ * @note The base sends a beacon at the start of each superframe and listens
+ *       for the rest of it, data is read with @ref rf24_available and
+ *       @ref rf24_read. Nodes listen around the expected beacon time
+ *       and stay in standby otherwise.
+ *
+ * @note This function should be called periodically. Nodes take the beacon
+ *       arrival time from @ref rf24_get_rx_timestamp_us, which is the IRQ
+ *       edge time when @ref rf24_set_irq_edge_time is used. Otherwise it is
+ *       the time the beacon is polled, and the polling interval adds to the
+ *       clock error, so it must stay well below the guard time.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_tdma_update(rf24_tdma_t* p_tdma);
+
+/**
+ * @brief Sends data from a node if one of its slots is starting.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ * @param buff   Pointer to the data to be sent.
+ * @param len    Number of bytes to be sent.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_BUSY Node is not synchronized or not at the start of its slots.
+ */
+rf24_status_t rf24_tdma_write(rf24_tdma_t* p_tdma, uint8_t* buff, uint8_t len);
+
+/**
+ * @brief Gets the time until the next slot owned by the node can be used.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ *
+ * @return Time in microseconds, 0 if a slot can be used now and
+ *         UINT32_MAX if the node is not synchronized or owns no slot.
+ */
+uint32_t rf24_tdma_time_to_slot_us(rf24_tdma_t* p_tdma);
+
+/**
+ * @brief Gets the base time estimated from the last beacon.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ *
+ * @return Base time in microseconds.
+ */
+uint32_t rf24_tdma_get_network_time_us(rf24_tdma_t* p_tdma);
+
+#endif // __RF24_TDMA_H__
@@ -0,0 +1,154 @@
+/**
+ * @file rf24_txq.h
+ *
+ * @brief nRF24L01 prioritized transmission queue, with per frame expiry and preemption.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_TXQ_H__
+#define __RF24_TXQ_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Constants
+ *****************************************/
+
+#ifndef RF24_TXQ_QUEUE_SIZE
+#define RF24_TXQ_QUEUE_SIZE 4
+#endif
+
+/**
+ * @brief Lifetime value for frames that never expire.
+ */
+#define RF24_TXQ_NO_EXPIRY 0
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Priority classes, from the most urgent.
+ */
+typedef enum rf24_txq_priority {
+    RF24_TXQ_URGENT = 0,  /**< Commands, preempt any other frame being sent. */
+    RF24_TXQ_NORMAL,
+    RF24_TXQ_LOW,         /**< Telemetry. */
+    RF24_TXQ_NUM_OF_PRIORITIES,
+} rf24_txq_priority_t;
+
+/**
+ * @brief Queued frame type.
+ */
+typedef struct rf24_txq_frame {
+    uint8_t             data[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t             size;
+    bool                enable_auto_ack;
+    rf24_txq_priority_t priority;
+    uint32_t            expiry_us;  /**< Time the frame becomes stale, unused without expiry. */
+    bool                expires;
+} rf24_txq_frame_t;
+
+/**
+ * @brief Priority class queue type.
+ */
+typedef struct rf24_txq_class {
+    rf24_txq_frame_t frames[RF24_TXQ_QUEUE_SIZE];
+    uint8_t          head;
+    uint8_t          count;
+} rf24_txq_class_t;
+
+/**
+ * @brief Transmission queue statistics type.
+ */
+typedef struct rf24_txq_stats {
+    uint32_t sent;
+    uint32_t failed;       /**< Frames dropped on max retransmissions. */
+    uint32_t expired;      /**< Frames dropped stale, queued or being sent. */
+    uint32_t preempted;    /**< Frames taken back from the device for a more urgent one. */
+    uint32_t overwritten;  /**< Oldest frames dropped because their class queue was full. */
+} rf24_txq_stats_t;
+
+/**
+ * @brief Transmission queue type.
+ *
+ * @note A single frame is kept in the device FIFO at a time: the FIFO does
+ *       not tell which of its payloads were sent, so a preempted frame could
+ *       not be queued again otherwise.
+ */
+typedef struct rf24_txq {
+    rf24_dev_t*       p_dev;
+    rf24_txq_class_t  classes[RF24_TXQ_NUM_OF_PRIORITIES];
+
+    rf24_txq_frame_t  in_flight;    /**< Frame in the device FIFO. */
+    bool              has_in_flight;
+
+    rf24_txq_stats_t  stats;
+} rf24_txq_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a transmission queue, empty.
+ *
+ * @note Be sure to call @ref rf24_open_writing_pipe first to set the
+ *       destination of the frames.
+ *
+ * @param p_txq Pointer to transmission queue.
+ * @param p_dev Pointer to rf24 device.
+ */
+void rf24_txq_init(rf24_txq_t* p_txq, rf24_dev_t* p_dev);
+
+/**
+ * @brief Queues a frame, without any SPI transfer.
+ *
+ * @note With the class queue full its oldest frame is dropped.
+ *
+ * @param p_txq           Pointer to transmission queue.
+ * @param buff            Pointer to the data to be sent.
+ * @param len             Number of bytes to be sent.
+ * @param enable_auto_ack Whether auto acknowledgement is enabled or not.
+ * @param priority        @ref rf24_txq_priority_t.
+ * @param lifetime_us     Time after which the frame is dropped, or @ref RF24_TXQ_NO_EXPIRY.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_txq_push(rf24_txq_t* p_txq, uint8_t* buff, uint8_t len, bool enable_auto_ack,
+                            rf24_txq_priority_t priority, uint32_t lifetime_us);
+
+/**
+ * @brief Follows the frame being sent and loads the next one.
+ *
+ * @note A frame being sent is flushed and queued again when a more urgent
+ *       one is waiting, and dropped once stale. Expired frames are dropped
+ *       instead of sent.
+ *
+ * @note This function should be called periodically, after each push of an
+ *       urgent frame and after the device IRQ is handled. The worst case
+ *       latency of an urgent frame is the time between two calls plus
+ *       its own transmission.
+ *
+ * @note @ref rf24_get_time_us must be implemented for the expiry.
+ *
+ * @param p_txq Pointer to transmission queue.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_txq_update(rf24_txq_t* p_txq);
+
+/**
+ * @brief Gets the number of frames queued or being sent.
+ *
+ * @param p_txq Pointer to transmission queue.
+ *
+ * @return Number of frames.
+ */
+uint8_t rf24_txq_pending(rf24_txq_t* p_txq);
+
+#endif // __RF24_TXQ_H__
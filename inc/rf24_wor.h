@@ -0,0 +1,107 @@
+/**
+ * @file rf24_wor.h
+ *
+ * @brief nRF24L01 duty cycled receiver (wake on radio) related.
+ *
+ * @date 10/2026
+ */
+
+#ifndef __RF24_WOR_H__
+#define __RF24_WOR_H__
+
+#include <stdint.h>
+
+#include "rf24.h"
+
+/*****************************************
+ * Public Types
+ *****************************************/
+
+/**
+ * @brief Duty cycled receiver type.
+ */
+typedef struct rf24_wor {
+    rf24_dev_t*        p_dev;
+
+    uint32_t           window_us;       /**< Time the receiver listens on each period. */
+    uint32_t           period_us;       /**< Time between the start of two receive windows. */
+    rf24_power_state_t sleep_state;     /**< State the receiver stays in between windows. */
+
+    uint32_t           window_start_us; /**< Start time of the last receive window. */
+    bool               listening;
+} rf24_wor_t;
+
+/*****************************************
+ * Public Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Initializes a duty cycled receiver or transmitter.
+ *
+ * @param p_wor          Pointer to duty cycled receiver.
+ * @param p_dev          Pointer to rf24 device.
+ * @param max_latency_us Max time between the start of a wake up burst and its reception.
+ * @param payload_len    Wake up payload length in bytes.
+ *
+ * @note Receiver and transmitter must use the same parameters. The receive
+ *       window fits two wake up packets, and the period is the rest of the
+ *       latency budget after the window and the wake up time.
+ *
+ * @note @ref rf24_get_time_us must be implemented by the user.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_INVALID_PARAMETERS The latency is too short for the period
+ *         to be longer than the window.
+ */
+rf24_status_t rf24_wor_init(rf24_wor_t* p_wor, rf24_dev_t* p_dev, uint32_t max_latency_us, uint8_t payload_len);
+
+/**
+ * @brief Updates the duty cycled receiver, opening and closing receive windows.
+ *
+ * @note This function should be called periodically, at least a few times
+ *       per receive window. The reading pipes must be opened beforehand.
+ *
+ * @note When a payload arrives the receiver keeps listening until
+ *       @ref rf24_wor_resume is called, so it can be read with @ref rf24_read.
+ *
+ * @param p_wor Pointer to duty cycled receiver.
+ *
+ * @return @ref rf24_status.
+ * @retval RF24_SUCCESS        A payload is available.
+ * @retval RF24_RX_FIFO_EMPTY  No payload has arrived.
+ */
+rf24_status_t rf24_wor_update(rf24_wor_t* p_wor);
+
+/**
+ * @brief Resumes duty cycling after a payload was received.
+ *
+ * @param p_wor Pointer to duty cycled receiver.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_wor_resume(rf24_wor_t* p_wor);
+
+/**
+ * @brief Sends a wake up burst, blocking until it covers a whole receiver period.
+ *
+ * @note The payload is sent without acknowledgement, reusing the
+ *       transmitter FIFO, see @ref rf24_write_continuously.
+ *
+ * @param p_wor Pointer to duty cycled transmitter.
+ * @param buff  Pointer to the data to be sent.
+ * @param len   Number of bytes to be sent, the same used in @ref rf24_wor_init.
+ *
+ * @return @ref rf24_status.
+ */
+rf24_status_t rf24_wor_send_wakeup(rf24_wor_t* p_wor, uint8_t* buff, uint8_t len);
+
+/**
+ * @brief Gets the fraction of time the receiver listens.
+ *
+ * @param p_wor Pointer to duty cycled receiver.
+ *
+ * @return Duty cycle in parts per million.
+ */
+uint32_t rf24_wor_get_duty_cycle_ppm(rf24_wor_t* p_wor);
+
+#endif // __RF24_WOR_H__
@@ -10,11 +10,13 @@
  * @date 10/2019
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
 
 #include "rf24.h"
+#include "rf24_histogram.h"
 #include "rf24_platform.h"
 
 /*****************************************
@@ -29,6 +31,11 @@
 #define DEFAULT_ADDRESS_SIZE 5U
 #define DEFAULT_CHANNEL_MHZ 76U
 
+/**
+ * @brief SETUP_AW register value is the address width minus this offset.
+ */
+#define ADDRESS_WIDTH_REG_OFFSET 2U
+
 #define MAX_RETRANSMISSIONS 0xFU
 
 /**
@@ -44,6 +51,40 @@
  */
 #define NUM_OF_RETRANSMISSIONS_DELAY_STEPS 5U
 
+/**
+ * @brief Max number of retransmissions delay steps.
+ */
+#define MAX_RETRANSMISSIONS_DELAY_STEPS 0xFU
+
+/**
+ * @brief Duration of each retransmissions delay step.
+ */
+#define RETRANSMISSIONS_DELAY_STEP_US 250U
+
+/**
+ * @brief Enhanced ShockBurst frame sizes.
+ *
+ * @note The packet control field has 6 bits of payload length,
+ *       2 bits of packet identity and 1 bit of no ACK flag.
+ */
+#define PREAMBLE_SIZE_BYTES 1U
+#define PACKET_CONTROL_FIELD_BITS 9U
+
+/**
+ * @brief Time the radio takes to switch between RX and TX modes.
+ */
+#define RX_TX_SETTLING_TIME_US 130U
+
+/**
+ * @brief Largest ACK payload that can be received with a 250us
+ *        retransmission delay, as stated in the datasheet.
+ *
+ * @note At 250kbps the delay must always be at least 500us.
+ */
+#define MAX_ACK_PAYLOAD_SHORT_DELAY_1MBPS 5U
+#define MAX_ACK_PAYLOAD_SHORT_DELAY_2MBPS 15U
+#define MIN_RETRANSMISSIONS_DELAY_STEPS_250KBPS 1U
+
 /**
  * @brief Width of operationg frequency. RF module con operate
  *        on frequencies from 2.400GHz to 2.525GHz.
@@ -53,7 +94,7 @@
 /**
  * @brief Max number of pipes available.
  */
-#define MAX_NUM_OF_PIPES 6
+#define MAX_NUM_OF_PIPES RF24_NUM_OF_PIPES
 
 /**
  * @brief Error value for status register.
@@ -62,6 +103,26 @@
  */
 #define STATUS_REG_ERROR_VALUE 0xFF
 
+/**
+ * @brief Time needed by the device to go from power down to standby.
+ */
+#define POWER_UP_DELAY_MS 5U
+
+/**
+ * @brief Time needed to start transmitting or receiving from power down.
+ */
+#define POWER_DOWN_WAKE_LATENCY_US (POWER_UP_DELAY_MS * 1000U + RX_TX_SETTLING_TIME_US)
+
+/**
+ * @brief Received sequence numbers remembered per pipe, behind the last one.
+ */
+#define SEQ_WINDOW_SIZE 16U
+
+/**
+ * @brief Sequence numbers ahead of the last one up to this distance are new, the others are old.
+ */
+#define SEQ_HALF_RANGE ((RF24_SEQ_MASK + 1U) / 2U)
+
 /**
  * @brief Error value for channel.
  *
@@ -70,13 +131,17 @@
 #define CHANNEL_ERROR_VALUE 0xFF
 
 /*****************************************
- * Private Macros
+ * Private Types
  *****************************************/
 
 /**
- * @brief Get bit value
+ * @brief Register of @ref rf24_config_t.
  */
-#define _BV(num) (1 << (num))
+typedef struct rf24_config_entry {
+    nrf24l01_registers_t reg;
+    uint8_t              offset;    /**< Offset of the register value in @ref rf24_config_t. */
+    uint8_t              size;      /**< Register size, addresses are written with the address width. */
+} rf24_config_entry_t;
 
 /*****************************************
  * Private Variables
@@ -88,18 +153,308 @@ static const uint8_t m_child_payload_size[] = {RX_PW_P0, RX_PW_P1, RX_PW_P2, RX_
 
 static const uint8_t m_child_pipe_enable[] = {ERX_P0, ERX_P1, ERX_P2, ERX_P3, ERX_P4, ERX_P5};
 
+static const uint8_t m_child_auto_ack[] = {ENAA_P0, ENAA_P1, ENAA_P2, ENAA_P3, ENAA_P4, ENAA_P5};
+
+/**
+ * @brief Configuration registers, in the order they are written.
+ */
+static const rf24_config_entry_t m_config_entries[] = {
+    {NRF24L01_REG_SETUP_AW, offsetof(rf24_config_t, setup_aw), 1},
+    {NRF24L01_REG_RX_ADDR_P0, offsetof(rf24_config_t, rx_addr_p0), RF24_ADDRESS_MAX_SIZE},
+    {NRF24L01_REG_RX_ADDR_P1, offsetof(rf24_config_t, rx_addr_p1), RF24_ADDRESS_MAX_SIZE},
+    {NRF24L01_REG_RX_ADDR_P2, offsetof(rf24_config_t, rx_addr_p2_to_p5) + 0, 1},
+    {NRF24L01_REG_RX_ADDR_P3, offsetof(rf24_config_t, rx_addr_p2_to_p5) + 1, 1},
+    {NRF24L01_REG_RX_ADDR_P4, offsetof(rf24_config_t, rx_addr_p2_to_p5) + 2, 1},
+    {NRF24L01_REG_RX_ADDR_P5, offsetof(rf24_config_t, rx_addr_p2_to_p5) + 3, 1},
+    {NRF24L01_REG_TX_ADDR, offsetof(rf24_config_t, tx_addr), RF24_ADDRESS_MAX_SIZE},
+    {NRF24L01_REG_RX_PW_P0, offsetof(rf24_config_t, rx_pw) + 0, 1},
+    {NRF24L01_REG_RX_PW_P1, offsetof(rf24_config_t, rx_pw) + 1, 1},
+    {NRF24L01_REG_RX_PW_P2, offsetof(rf24_config_t, rx_pw) + 2, 1},
+    {NRF24L01_REG_RX_PW_P3, offsetof(rf24_config_t, rx_pw) + 3, 1},
+    {NRF24L01_REG_RX_PW_P4, offsetof(rf24_config_t, rx_pw) + 4, 1},
+    {NRF24L01_REG_RX_PW_P5, offsetof(rf24_config_t, rx_pw) + 5, 1},
+    {NRF24L01_REG_EN_RXADDR, offsetof(rf24_config_t, en_rxaddr), 1},
+    {NRF24L01_REG_EN_AA, offsetof(rf24_config_t, en_aa), 1},
+    {NRF24L01_REG_SETUP_RETR, offsetof(rf24_config_t, setup_retr), 1},
+    {NRF24L01_REG_RF_CH, offsetof(rf24_config_t, rf_ch), 1},
+    {NRF24L01_REG_RF_SETUP, offsetof(rf24_config_t, rf_setup), 1},
+    {NRF24L01_REG_FEATURE, offsetof(rf24_config_t, feature), 1},
+    {NRF24L01_REG_DYNPD, offsetof(rf24_config_t, dynpd), 1},
+    {NRF24L01_REG_CONFIG, offsetof(rf24_config_t, config), 1},
+};
+
+#define NUM_OF_CONFIG_ENTRIES (sizeof(m_config_entries) / sizeof(m_config_entries[0]))
+
+/**
+ * @brief Registers reset values, as stated in the datasheet.
+ */
+static const rf24_config_t m_reset_config = {
+    .config = {0x08},
+    .en_aa = {0x3F},
+    .en_rxaddr = {0x03},
+    .setup_aw = {0x03},
+    .setup_retr = {0x03},
+    .rf_ch = {0x02},
+    .rf_setup = {0x0F},
+    .rx_addr_p0 = {0xE7, 0xE7, 0xE7, 0xE7, 0xE7},
+    .rx_addr_p1 = {0xC2, 0xC2, 0xC2, 0xC2, 0xC2},
+    .rx_addr_p2_to_p5 = {0xC3, 0xC4, 0xC5, 0xC6},
+    .tx_addr = {0xE7, 0xE7, 0xE7, 0xE7, 0xE7},
+    .rx_pw = {0, 0, 0, 0, 0, 0},
+    .dynpd = {0x00},
+    .feature = {0x00},
+};
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Writes the retries configuration register.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param delay_steps Steps of delay
+ * @param rt_count    Count of retransmissions.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_write_retries(rf24_dev_t* p_dev, uint8_t delay_steps, uint8_t rt_count);
+
+/**
+ * @brief Writes the retries configuration stored in the device,
+ *        deriving the delay when using @ref RF24_RETRY_DELAY_AUTO.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_apply_retries(rf24_dev_t* p_dev);
+
+/**
+ * @brief Writes a device register and updates the registers image.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param reg   Register to be written
+ * @param buff  Buffer with the register value
+ * @param len   Buffer lenght
+ *
+ * @return @ref rf24_platform_status.
+ */
+static rf24_platform_status_t rf24_write_register(rf24_dev_t* p_dev, nrf24l01_registers_t reg, uint8_t* buff,
+                                                  uint8_t len);
+
+/**
+ * @brief Writes a 8 bit device register and updates the registers image.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param reg   Register to be written
+ * @param value Value to be written in the register
+ *
+ * @return @ref rf24_platform_status.
+ */
+static rf24_platform_status_t rf24_write_reg8(rf24_dev_t* p_dev, nrf24l01_registers_t reg, uint8_t value);
+
+/**
+ * @brief Finds a register in the configuration entries.
+ *
+ * @param reg Register to be found.
+ *
+ * @return Pointer to the entry, NULL if the register isn't a configuration one.
+ */
+static const rf24_config_entry_t* rf24_find_config_entry(nrf24l01_registers_t reg);
+
+/**
+ * @brief Changes the power state, accounting the time spent on the last one.
+ *
+ * @param p_dev Pointer to rf24 device.
+ * @param state New power state.
+ */
+static void rf24_set_power_state(rf24_dev_t* p_dev, rf24_power_state_t state);
+
+/**
+ * @brief Powers up the device if it was powered down by the power manager.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_wake_up(rf24_dev_t* p_dev);
+
+/**
+ * @brief Delays for at least the given time.
+ *
+ * @param us Delay in microseconds.
+ */
+static void rf24_delay_us(uint32_t us);
+
+/**
+ * @brief Builds the registers configuration set on initialization.
+ *
+ * @param p_dev    Pointer to rf24 device.
+ * @param p_config Pointer to the configuration to be filled.
+ */
+static void rf24_build_init_config(rf24_dev_t* p_dev, rf24_config_t* p_config);
+
+/**
+ * @brief Sets CRC configuration bits.
+ *
+ * @param crc_length   CRC length.
+ * @param p_reg_config Pointer to the config register value to be updated.
+ */
+static void rf24_fill_crc_config(rf24_crc_length_t crc_length, nrf24l01_reg_config_t* p_reg_config);
+
+/**
+ * @brief Checks if the enabled reading pipes addresses are still unique
+ *        with a given address width.
+ *
+ * @param p_dev      Pointer to rf24 device.
+ * @param addr_width Address width to be checked.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_validate_pipe_addresses(rf24_dev_t* p_dev, uint8_t addr_width);
+
+/**
+ * @brief Gets the airtime of a frame, without settling times.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param payload_len Payload length in bytes.
+ *
+ * @return Airtime in microseconds.
+ */
+static uint32_t rf24_frame_airtime_us(rf24_dev_t* p_dev, uint8_t payload_len);
+
+/**
+ * @brief Converts a number of bits to its airtime.
+ *
+ * @param datarate Data rate used to send the bits.
+ * @param bits     Number of bits.
+ *
+ * @return Airtime in microseconds.
+ */
+static uint32_t rf24_bits_to_us(rf24_datarate_t datarate, uint32_t bits);
+
+/**
+ * @brief Gets the time an ACK being sent takes to end, waited by @ref rf24_stop_listening.
+ *
+ * @note The device may have just received a payload and be sending its ACK,
+ *       with the ACK payload if any, which must not be cut by the flushes.
+ *
+ * @param p_dev Pointer to rf24 device.
+ *
+ * @return Delay in microseconds.
+ */
+static uint32_t rf24_get_tx_delay_us(rf24_dev_t* p_dev);
+
+/**
+ * @brief Gets the static payload size of a pipe.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param pipe_number Number of the pipe.
+ *
+ * @return Payload size in bytes.
+ */
+static uint8_t rf24_get_pipe_payload_size(rf24_dev_t* p_dev, uint8_t pipe_number);
+
+/**
+ * @brief Reads the next payload in the receiver FIFO as it was received.
+ *
+ * @param p_dev  Pointer to rf24 device.
+ * @param buff   Pointer to a buffer where the payload should be written.
+ * @param len    Size of the buffer.
+ * @param p_pipe Pointer to store the pipe the payload came from.
+ * @param p_size Pointer to store the payload size.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_read_payload(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, uint8_t* p_pipe,
+                                       uint8_t* p_size);
+
+/**
+ * @brief Writes a payload in the transmission FIFO, adding the sequence header when enabled.
+ *
+ * @param p_dev           Pointer to rf24 device.
+ * @param buff            Pointer to the data to be sent.
+ * @param len             Number of bytes to be sent.
+ * @param enable_auto_ack Whether auto acknowledgement is enabled or not.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_load_payload(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack);
+
+/**
+ * @brief Checks a received sequence header against the pipe window, updating it.
+ *
+ * @param p_window Pointer to the pipe window.
+ * @param header   Received sequence header.
+ *
+ * @return Whether the payload is new or a duplicate.
+ */
+static bool rf24_seq_accept(rf24_seq_window_t* p_window, uint8_t header);
+
+/**
+ * @brief Records a payload read from a pipe in the link activity.
+ *
+ * @param p_dev       Pointer to rf24 device.
+ * @param pipe_number Number of the pipe.
+ */
+static void rf24_track_rx(rf24_dev_t* p_dev, uint8_t pipe_number);
+
+/**
+ * @brief Records the result of a transmission in the link activity.
+ *
+ * @param p_dev     Pointer to rf24 device.
+ * @param delivered Whether the payload was sent or the max retransmissions were reached.
+ */
+static void rf24_track_tx(rf24_dev_t* p_dev, bool delivered);
+
+/**
+ * @brief Drops the receiver interruption time once the FIFO is drained.
+ *
+ * @note Payloads arriving later are stamped when read, until the next
+ *       interruption is handled.
+ *
+ * @param p_dev Pointer to rf24 device.
+ */
+static void rf24_track_rx_drained(rf24_dev_t* p_dev);
+
+/**
+ * @brief Waits for the IRQ pin to assert, when waiting on it is enabled.
+ *
+ * @param p_dev      Pointer to rf24 device.
+ * @param start_us   Time the wait started.
+ * @param timeout_us Max time to wait, or @ref RF24_NO_TIMEOUT.
+ *
+ * @return Whether the pin asserted, or true when not waiting on it, before the deadline.
+ */
+static bool rf24_wait_irq(rf24_dev_t* p_dev, uint32_t start_us, uint32_t timeout_us);
+
+/**
+ * @brief Checks whether a deadline passed.
+ *
+ * @param start_us   Time the wait started.
+ * @param timeout_us Max time to wait, or @ref RF24_NO_TIMEOUT.
+ *
+ * @return Whether the deadline passed.
+ */
+static bool rf24_deadline_passed(uint32_t start_us, uint32_t timeout_us);
+
 /**
+ * @brief Calls the event callbacks for the interruptions in a status value.
  *
- * The driver will delay for this duration when stopListening() is called
+ * @param p_dev      Pointer to rf24 device.
+ * @param status_reg Status read on the interruption.
+ */
+static void rf24_dispatch_callbacks(rf24_dev_t* p_dev, nrf24l01_reg_status_t status_reg);
+
+/**
+ * @brief Gets the time of the event being handled, the IRQ edge one when set.
  *
- * When responding to payloads, faster devices like ARM(RPi) are much faster than Arduino:
- * 1. Arduino sends data to RPi, switches to RX mode
- * 2. The RPi receives the data, switches to TX mode and sends before the Arduino radio is in RX mode
- * 3. If AutoACK is disabled, this can be set as low as 0. If AA/ESB enabled, set to 100uS minimum on RPi
+ * @param p_dev Pointer to rf24 device.
  *
- * @warning If set to 0, ensure 130uS delay after stopListening() and before any sends
+ * @return Event time in microseconds.
  */
-static uint32_t m_tx_delay = 250;
+static uint32_t rf24_event_time_us(rf24_dev_t* p_dev);
 
 /*****************************************
  * Public Functions Bodies Definitions
@@ -111,11 +466,27 @@ rf24_status_t rf24_get_default_config(rf24_dev_t* p_dev) {
     p_dev->addr_width = DEFAULT_ADDRESS_SIZE;
     p_dev->datarate = RF24_1MBPS;
     p_dev->channel = DEFAULT_CHANNEL_MHZ;
+    p_dev->crc_length = RF24_CRC_16_BITS;
+    p_dev->retry_mode = RF24_RETRY_DELAY_AUTO;
+    p_dev->retry_delay_steps = NUM_OF_RETRANSMISSIONS_DELAY_STEPS;
+    p_dev->retransmit_count = MAX_RETRANSMISSIONS;
+    p_dev->ack_payload_size = 0;
+    p_dev->wait_mode = RF24_WAIT_SPI_POLL;
+
+    memset(&(p_dev->power), 0, sizeof(p_dev->power));
 
     for (uint8_t i = 0; i < RF24_ADDRESS_MAX_SIZE; i++) {
         p_dev->pipe0_reading_address[i] = 0;
     }
 
+    memset(p_dev->pipe_payload_size, 0, sizeof(p_dev->pipe_payload_size));
+
+    rf24_enable_seq_header(p_dev, false);
+
+    memset(&(p_dev->link), 0, sizeof(p_dev->link));
+    memset(&(p_dev->callbacks), 0, sizeof(p_dev->callbacks));
+    memset(&(p_dev->timestamps), 0, sizeof(p_dev->timestamps));
+
     return RF24_SUCCESS;
 }
 
@@ -124,6 +495,7 @@ rf24_status_t rf24_init(rf24_dev_t* p_dev) {
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
 
     nrf24l01_reg_rf_setup_t rf_setup_reg;
+    rf24_config_t config;
 
     if (dev_status == RF24_SUCCESS) {
         rf24_platform_init(&(p_dev->platform_setup));
@@ -131,17 +503,19 @@ rf24_status_t rf24_init(rf24_dev_t* p_dev) {
 
     rf24_delay(5);
 
-    if (dev_status == RF24_SUCCESS) {
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, 0x0C);
-        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    if ((p_dev->addr_width < RF24_ADDRESS_MIN_SIZE) || (p_dev->addr_width > RF24_ADDRESS_MAX_SIZE)) {
+        dev_status = RF24_INVALID_PARAMETERS;
     }
 
+    // Registers are unknown after a reset, so the whole configuration is written
     if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_set_retries(p_dev, NUM_OF_RETRANSMISSIONS_DELAY_STEPS, MAX_RETRANSMISSIONS);
+        p_dev->reg_image_valid = false;
+        rf24_build_init_config(p_dev, &config);
+        dev_status = rf24_apply_config(p_dev, &config, false);
     }
 
     if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_set_datarate(p_dev, p_dev->datarate);
+        rf24_set_power_state(p_dev, RF24_STANDBY_I);
     }
 
     if (dev_status == RF24_SUCCESS) {
@@ -151,50 +525,203 @@ rf24_status_t rf24_init(rf24_dev_t* p_dev) {
     }
 
     if (dev_status == RF24_SUCCESS) {
-        nrf24l01_reg_feature_t reg_feature = {0x00};
-        reg_feature.en_dyn_ack = 1;
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_FEATURE, reg_feature.value);
-        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+        dev_status = rf24_flush_rx(p_dev);
     }
 
     if (dev_status == RF24_SUCCESS) {
-        nrf24l01_reg_dynpd_t reg_dynpd = {0x00};
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_DYNPD, reg_dynpd.value);
-        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+        dev_status = rf24_flush_tx(p_dev);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        // If setup is 0x00 or 0xFF then there was no response from module. Bit 0 is not
+        // compared, it is obsolete on the nRF24L01+ and a PA bit on Si24R1 clones
+        if ((rf_setup_reg.value == 0x00) || (rf_setup_reg.value == 0xFF) ||
+            (rf_setup_reg.rf_dr_low != config.rf_setup.rf_dr_low) ||
+            (rf_setup_reg.rf_dr_high != config.rf_setup.rf_dr_high) ||
+            (rf_setup_reg.rf_pwr != config.rf_setup.rf_pwr)) {
+            dev_status = RF24_UNKNOWN_ERROR;
+        }
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_warm_init(rf24_dev_t* p_dev) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    rf24_config_t live_config;
+    rf24_config_t config;
+
+    rf24_platform_init(&(p_dev->platform_setup));
+    rf24_platform_disable(&(p_dev->platform_setup));
+
+    if ((p_dev->addr_width < RF24_ADDRESS_MIN_SIZE) || (p_dev->addr_width > RF24_ADDRESS_MAX_SIZE)) {
+        dev_status = RF24_INVALID_PARAMETERS;
     }
 
     if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_set_channel(p_dev, p_dev->channel);
+        dev_status = rf24_read_config(p_dev, &live_config);
     }
 
     if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_flush_rx(p_dev);
+        // If setup is 0x00 or 0xFF then there was no response from module
+        if ((live_config.rf_setup.value == 0x00) || (live_config.rf_setup.value == 0xFF)) {
+            dev_status = RF24_UNKNOWN_ERROR;
+        }
     }
 
     if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_flush_tx(p_dev);
+        p_dev->reg_image = live_config;
+        p_dev->reg_image_valid = true;
+
+        // Otherwise the next rf24_start_listening closes pipe 0
+        if (live_config.en_rxaddr.erx_p0) {
+            memcpy(p_dev->pipe0_reading_address, live_config.rx_addr_p0, p_dev->addr_width);
+        }
+
+        rf24_build_init_config(p_dev, &config);
+        dev_status = rf24_apply_config(p_dev, &config, false);
     }
 
     if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_power_up(p_dev);
+        rf24_set_power_state(p_dev, RF24_STANDBY_I);
     }
 
+    // Queued packets are only valid if they would be sent and received with the same format
     if (dev_status == RF24_SUCCESS) {
-        nrf24l01_reg_config_t reg_config;
-        platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, &(reg_config.value));
+        nrf24l01_reg_config_t crc_mask = {0x00};
+        crc_mask.en_crc = 1;
+        crc_mask.crco = 1;
+
+        nrf24l01_reg_rf_setup_t datarate_mask = {0x00};
+        datarate_mask.rf_dr_low = 1;
+        datarate_mask.rf_dr_high = 1;
+
+        bool frame_changed = (live_config.setup_aw.value != config.setup_aw.value) ||
+                             ((live_config.config.value ^ config.config.value) & crc_mask.value) ||
+                             ((live_config.rf_setup.value ^ config.rf_setup.value) & datarate_mask.value) ||
+                             (live_config.feature.value != config.feature.value) ||
+                             (live_config.dynpd.value != config.dynpd.value);
+
+        if (frame_changed) {
+            dev_status = rf24_flush_rx(p_dev);
+        }
+
+        if ((dev_status == RF24_SUCCESS) &&
+            (frame_changed || (memcmp(live_config.tx_addr, config.tx_addr, p_dev->addr_width) != 0))) {
+            dev_status = rf24_flush_tx(p_dev);
+        }
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_read_config(rf24_dev_t* p_dev, rf24_config_t* p_config) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    uint8_t* p_values = (uint8_t*) p_config;
+
+    for (uint8_t i = 0; (i < NUM_OF_CONFIG_ENTRIES) && (dev_status == RF24_SUCCESS); i++) {
+        platform_status = rf24_platform_read_register(&(p_dev->platform_setup), m_config_entries[i].reg,
+                                                      &(p_values[m_config_entries[i].offset]), m_config_entries[i].size);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
 
-        if (dev_status == RF24_SUCCESS) {
-            reg_config.prim_rx = 0;
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, reg_config.value);
-            dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    return dev_status;
+}
+
+void rf24_build_config(rf24_dev_t* p_dev, rf24_config_t* p_config) {
+    *p_config = p_dev->reg_image_valid ? p_dev->reg_image : m_reset_config;
+
+    rf24_fill_crc_config(p_dev->crc_length, &(p_config->config));
+
+    // Auto acknowledgement forces CRC, so it is only enabled when CRC is used
+    if (p_dev->crc_length == RF24_CRC_DISABLED) {
+        p_config->en_aa.value = 0x00;
+    }
+
+    p_config->setup_aw.aw = p_dev->addr_width - ADDRESS_WIDTH_REG_OFFSET;
+
+    if (p_dev->retry_mode == RF24_RETRY_DELAY_AUTO) {
+        p_dev->retry_delay_steps = rf24_get_min_retry_delay_steps(p_dev);
+    }
+
+    p_config->setup_retr.ard = p_dev->retry_delay_steps;
+    p_config->setup_retr.arc = p_dev->retransmit_count;
+
+    p_config->rf_ch.rf_ch = (p_dev->channel > OPERATING_FREQUENCY_WIDTH_MHZ) ?
+                            (OPERATING_FREQUENCY_WIDTH_MHZ) : (p_dev->channel);
+
+    p_config->rf_setup.rf_dr_low = (p_dev->datarate == RF24_250KBPS) ? 1 : 0;
+    p_config->rf_setup.rf_dr_high = (p_dev->datarate == RF24_2MBPS) ? 1 : 0;
+
+    p_config->feature.en_dyn_ack = 1;
+}
+
+rf24_status_t rf24_apply_config(rf24_dev_t* p_dev, const rf24_config_t* p_config, bool verify) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    const uint8_t* p_new = (const uint8_t*) p_config;
+    const uint8_t* p_old = (const uint8_t*) &(p_dev->reg_image);
+    uint8_t addr_width = p_config->setup_aw.aw + ADDRESS_WIDTH_REG_OFFSET;
+    bool written[NUM_OF_CONFIG_ENTRIES] = {false};
+    bool powering_up = (p_config->config.pwr_up == 1) &&
+                       ((!p_dev->reg_image_valid) || (p_dev->reg_image.config.pwr_up == 0));
+
+    if ((addr_width < RF24_ADDRESS_MIN_SIZE) || (addr_width > RF24_ADDRESS_MAX_SIZE)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    for (uint8_t i = 0; (i < NUM_OF_CONFIG_ENTRIES) && (dev_status == RF24_SUCCESS); i++) {
+        const rf24_config_entry_t* p_entry = &(m_config_entries[i]);
+        uint8_t len = (p_entry->size == 1) ? 1 : addr_width;
+
+        if (p_dev->reg_image_valid && (memcmp(&(p_new[p_entry->offset]), &(p_old[p_entry->offset]), len) == 0)) {
+            continue;
         }
+
+        platform_status = rf24_write_register(p_dev, p_entry->reg, (uint8_t*) &(p_new[p_entry->offset]), len);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+        written[i] = true;
     }
 
     if (dev_status == RF24_SUCCESS) {
-        // If setup is 0x00 or 0xFF then there was no response from module
-        if ((rf_setup_reg.value == 0x00) || (rf_setup_reg.value == 0xFF)) {
-            dev_status = RF24_UNKNOWN_ERROR;
+        p_dev->reg_image = *p_config;
+        p_dev->reg_image_valid = true;
+
+        p_dev->addr_width = addr_width;
+        p_dev->crc_length = (p_config->config.en_crc == 0) ? (RF24_CRC_DISABLED) :
+                            (p_config->config.crco == 1) ? (RF24_CRC_16_BITS) : (RF24_CRC_8_BITS);
+        p_dev->retry_delay_steps = p_config->setup_retr.ard;
+        p_dev->retransmit_count = p_config->setup_retr.arc;
+        p_dev->channel = p_config->rf_ch.rf_ch;
+        p_dev->datarate = (p_config->rf_setup.rf_dr_low == 1) ? (RF24_250KBPS) :
+                          (p_config->rf_setup.rf_dr_high == 1) ? (RF24_2MBPS) : (RF24_1MBPS);
+    }
+
+    if ((dev_status == RF24_SUCCESS) && powering_up) {
+        rf24_delay(POWER_UP_DELAY_MS);
+    }
+
+    for (uint8_t i = 0; verify && (i < NUM_OF_CONFIG_ENTRIES) && (dev_status == RF24_SUCCESS); i++) {
+        const rf24_config_entry_t* p_entry = &(m_config_entries[i]);
+        uint8_t len = (p_entry->size == 1) ? 1 : addr_width;
+        uint8_t temp_reg[RF24_ADDRESS_MAX_SIZE];
+
+        if (!written[i]) {
+            continue;
+        }
+
+        platform_status = rf24_platform_read_register(&(p_dev->platform_setup), p_entry->reg, temp_reg, len);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+        if (dev_status == RF24_SUCCESS) {
+            if (memcmp(temp_reg, &(p_new[p_entry->offset]), len) != 0) {
+                p_dev->reg_image_valid = false;
+                dev_status = RF24_UNKNOWN_ERROR;
+            }
         }
     }
 
@@ -206,6 +733,11 @@ rf24_status_t rf24_power_up(rf24_dev_t* p_dev) {
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
     nrf24l01_reg_config_t reg_config;
 
+    // Already powered up devices don't need the power up delay
+    if (p_dev->reg_image_valid && (p_dev->reg_image.config.pwr_up == 1)) {
+        return dev_status;
+    }
+
     platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, &(reg_config.value));
     dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
 
@@ -217,11 +749,16 @@ rf24_status_t rf24_power_up(rf24_dev_t* p_dev) {
 
     if (dev_status == RF24_SUCCESS) {
         reg_config.pwr_up = 1;
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, reg_config.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_CONFIG, reg_config.value);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
-    rf24_delay(5);
+    rf24_delay(POWER_UP_DELAY_MS);
+
+    if (dev_status == RF24_SUCCESS) {
+        p_dev->power.wake_ups++;
+        rf24_set_power_state(p_dev, RF24_STANDBY_I);
+    }
 
     return dev_status;
 }
@@ -243,19 +780,110 @@ rf24_status_t rf24_power_down(rf24_dev_t* p_dev) {
     if (dev_status == RF24_SUCCESS) {
         rf24_platform_disable(&(p_dev->platform_setup));
         reg_config.pwr_up = 0;
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, reg_config.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_CONFIG, reg_config.value);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
+    if (dev_status == RF24_SUCCESS) {
+        rf24_set_power_state(p_dev, RF24_POWER_DOWN);
+    }
+
     return dev_status;
 }
 
-rf24_status_t rf24_set_channel(rf24_dev_t* p_dev, uint8_t ch) {
+rf24_status_t rf24_power_manager_config(rf24_dev_t* p_dev, uint32_t idle_timeout_us, uint32_t wake_latency_us) {
+    p_dev->power.idle_timeout_us = idle_timeout_us;
+    p_dev->power.wake_latency_us = wake_latency_us;
+    p_dev->power.last_activity_us = rf24_get_time_us();
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_power_manager_update(rf24_dev_t* p_dev) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_power_manager_t* p_power = &(p_dev->power);
+
+    if (p_power->idle_timeout_us == 0) {
+        return dev_status;
+    }
+
+    // CE is kept high after the last payload, the device waits in standby-II
+    if (p_power->state == RF24_TX_MODE) {
+        nrf24l01_reg_fifo_status_t reg_fifo_status;
+        uint32_t last_activity_us = p_power->last_activity_us;
+
+        rf24_platform_status_t platform_status =
+            rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_FIFO_STATUS, &(reg_fifo_status.value));
+
+        if (platform_status != RF24_PLATFORM_SUCCESS) {
+            return RF24_ERROR_CONTROL_INTERFACE;
+        }
+
+        if (reg_fifo_status.tx_empty) {
+            rf24_set_power_state(p_dev, RF24_STANDBY_II);
+            p_power->last_activity_us = last_activity_us;
+        }
+    }
+
+    if ((rf24_get_time_us() - p_power->last_activity_us) < p_power->idle_timeout_us) {
+        return dev_status;
+    }
+
+    if (p_power->state == RF24_STANDBY_II) {
+        rf24_platform_disable(&(p_dev->platform_setup));
+        rf24_set_power_state(p_dev, RF24_STANDBY_I);
+    }
+
+    // Standby-I already wakes up in the settling time, so it is the fallback state
+    if ((p_power->state == RF24_STANDBY_I) && (p_power->wake_latency_us >= POWER_DOWN_WAKE_LATENCY_US)) {
+        dev_status = rf24_power_down(p_dev);
+    }
+
+    return dev_status;
+}
+
+uint32_t rf24_get_wake_latency_us(rf24_power_state_t state) {
+    switch (state) {
+        case RF24_POWER_DOWN: {
+            return POWER_DOWN_WAKE_LATENCY_US;
+        }
+
+        case RF24_STANDBY_I: {
+            return RX_TX_SETTLING_TIME_US;
+        }
+
+        default: {
+            return 0;
+        }
+    }
+}
+
+rf24_power_state_t rf24_get_power_state(rf24_dev_t* p_dev) {
+    return p_dev->power.state;
+}
+
+void rf24_get_power_residency(rf24_dev_t* p_dev, uint64_t residency_us[RF24_NUM_OF_POWER_STATES]) {
+    for (uint8_t i = 0; i < RF24_NUM_OF_POWER_STATES; i++) {
+        residency_us[i] = p_dev->power.residency_us[i];
+    }
+
+    residency_us[p_dev->power.state] += rf24_get_time_us() - p_dev->power.state_entry_us;
+}
+
+void rf24_reset_power_residency(rf24_dev_t* p_dev) {
+    for (uint8_t i = 0; i < RF24_NUM_OF_POWER_STATES; i++) {
+        p_dev->power.residency_us[i] = 0;
+    }
+
+    p_dev->power.state_entry_us = rf24_get_time_us();
+}
+
+rf24_status_t rf24_set_channel(rf24_dev_t* p_dev, uint8_t ch) {
     rf24_status_t dev_status = RF24_SUCCESS;
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
 
     ch = ch > OPERATING_FREQUENCY_WIDTH_MHZ ? OPERATING_FREQUENCY_WIDTH_MHZ : ch;
-    platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_RF_CH, ch);
+    platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_RF_CH, ch);
     dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
 
     if (dev_status == RF24_SUCCESS) {
@@ -281,15 +909,235 @@ uint8_t rf24_get_channel(rf24_dev_t* p_dev) {
 }
 
 rf24_status_t rf24_set_retries(rf24_dev_t* p_dev, uint8_t delay_steps, uint8_t rt_count) {
+    rf24_status_t dev_status = rf24_write_retries(p_dev, delay_steps, rt_count);
+
+    if (dev_status == RF24_SUCCESS) {
+        p_dev->retry_mode = RF24_RETRY_DELAY_FIXED;
+        p_dev->retry_delay_steps = delay_steps;
+        p_dev->retransmit_count = rt_count;
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_set_auto_retries(rf24_dev_t* p_dev, uint8_t rt_count) {
+    p_dev->retry_mode = RF24_RETRY_DELAY_AUTO;
+    p_dev->retransmit_count = rt_count;
+
+    return rf24_apply_retries(p_dev);
+}
+
+uint8_t rf24_get_min_retry_delay_steps(rf24_dev_t* p_dev) {
+    uint32_t delay_us = RX_TX_SETTLING_TIME_US + rf24_frame_airtime_us(p_dev, p_dev->ack_payload_size);
+
+    // Smallest number of steps whose delay, (steps + 1) * 250us, covers the ACK
+    uint32_t delay_steps = (delay_us + RETRANSMISSIONS_DELAY_STEP_US - 1) / RETRANSMISSIONS_DELAY_STEP_US - 1;
+
+    switch (p_dev->datarate) {
+        case RF24_1MBPS: {
+            if ((p_dev->ack_payload_size > MAX_ACK_PAYLOAD_SHORT_DELAY_1MBPS) && (delay_steps < 1)) {
+                delay_steps = 1;
+            }
+
+            break;
+        }
+
+        case RF24_2MBPS: {
+            if ((p_dev->ack_payload_size > MAX_ACK_PAYLOAD_SHORT_DELAY_2MBPS) && (delay_steps < 1)) {
+                delay_steps = 1;
+            }
+
+            break;
+        }
+
+        case RF24_250KBPS: {
+            if (delay_steps < MIN_RETRANSMISSIONS_DELAY_STEPS_250KBPS) {
+                delay_steps = MIN_RETRANSMISSIONS_DELAY_STEPS_250KBPS;
+            }
+
+            break;
+        }
+    }
+
+    return (delay_steps > MAX_RETRANSMISSIONS_DELAY_STEPS) ? (MAX_RETRANSMISSIONS_DELAY_STEPS) : (delay_steps);
+}
+
+rf24_status_t rf24_set_ack_payload_size(rf24_dev_t* p_dev, uint8_t size) {
+    if (size > RF24_MAX_PAYLOAD_SIZE) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    p_dev->ack_payload_size = size;
+
+    return rf24_apply_retries(p_dev);
+}
+
+void rf24_enable_seq_header(rf24_dev_t* p_dev, bool enable) {
+    p_dev->seq_enabled = enable;
+    p_dev->seq_sync_pending = true;
+    p_dev->tx_seq = 0;
+
+    memset(p_dev->seq_windows, 0, sizeof(p_dev->seq_windows));
+}
+
+rf24_status_t rf24_get_seq_window(rf24_dev_t* p_dev, uint8_t pipe_number, rf24_seq_window_t* p_window) {
+    if (pipe_number >= MAX_NUM_OF_PIPES) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    *p_window = p_dev->seq_windows[pipe_number];
+
+    return RF24_SUCCESS;
+}
+
+uint8_t rf24_get_payload_capacity(rf24_dev_t* p_dev) {
+    return p_dev->seq_enabled ? (p_dev->payload_size - RF24_SEQ_HEADER_SIZE) : (p_dev->payload_size);
+}
+
+uint32_t rf24_airtime_us(rf24_dev_t* p_dev, uint8_t payload_len, bool enable_auto_ack) {
+    uint32_t airtime_us = RX_TX_SETTLING_TIME_US + rf24_frame_airtime_us(p_dev, payload_len);
+
+    if (enable_auto_ack) {
+        airtime_us += RX_TX_SETTLING_TIME_US + rf24_frame_airtime_us(p_dev, p_dev->ack_payload_size);
+    }
+
+    return airtime_us;
+}
+
+uint32_t rf24_worst_case_airtime_us(rf24_dev_t* p_dev, uint8_t payload_len) {
+    uint32_t delay_us = (p_dev->retry_delay_steps + 1) * RETRANSMISSIONS_DELAY_STEP_US;
+
+    // Each attempt is followed by the auto retransmit delay, which already includes the settling time
+    return RX_TX_SETTLING_TIME_US + (p_dev->retransmit_count + 1) * (rf24_frame_airtime_us(p_dev, payload_len) + delay_us);
+}
+
+uint32_t rf24_max_throughput(rf24_dev_t* p_dev, uint8_t payload_len, bool enable_auto_ack) {
+    return (payload_len * 1000000UL) / rf24_airtime_us(p_dev, payload_len, enable_auto_ack);
+}
+
+rf24_status_t rf24_set_frame_format(rf24_dev_t* p_dev, uint8_t addr_width, rf24_crc_length_t crc_length) {
     rf24_status_t dev_status = RF24_SUCCESS;
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
 
-    nrf24l01_reg_setup_retr_t reg;
-    reg.ard = delay_steps;
-    reg.arc = rt_count;
+    nrf24l01_reg_config_t reg_config;
+
+    if ((addr_width < RF24_ADDRESS_MIN_SIZE) || (addr_width > RF24_ADDRESS_MAX_SIZE) ||
+        (crc_length > RF24_CRC_16_BITS)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    // Datasheet says EN_CRC is forced high if any pipe has auto acknowledgement enabled
+    if (crc_length == RF24_CRC_DISABLED) {
+        nrf24l01_reg_en_aa_t reg_en_aa;
+        platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_EN_AA, &(reg_en_aa.value));
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+        if ((dev_status == RF24_SUCCESS) && (reg_en_aa.value != 0)) {
+            dev_status = RF24_INVALID_PARAMETERS;
+        }
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_validate_pipe_addresses(p_dev, addr_width);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        nrf24l01_reg_setup_aw_t reg_setup_aw = {0x00};
+        reg_setup_aw.aw = addr_width - ADDRESS_WIDTH_REG_OFFSET;
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_SETUP_AW, reg_setup_aw.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, &(reg_config.value));
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        rf24_fill_crc_config(crc_length, &reg_config);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_CONFIG, reg_config.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        p_dev->addr_width = addr_width;
+        p_dev->crc_length = crc_length;
+        dev_status = rf24_apply_retries(p_dev);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_set_auto_ack(rf24_dev_t* p_dev, uint8_t pipe_number, bool enable) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    nrf24l01_reg_en_aa_t reg_en_aa;
+
+    if ((pipe_number >= MAX_NUM_OF_PIPES) || (enable && (p_dev->crc_length == RF24_CRC_DISABLED))) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_EN_AA, &(reg_en_aa.value));
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+    if (dev_status == RF24_SUCCESS) {
+        if (enable) {
+            reg_en_aa.value |= _BV(m_child_auto_ack[pipe_number]);
+        } else {
+            reg_en_aa.value &= (~_BV(m_child_auto_ack[pipe_number]));
+        }
+
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_EN_AA, reg_en_aa.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_set_pipe_payload_size(rf24_dev_t* p_dev, uint8_t pipe_number, uint8_t size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    if ((pipe_number >= MAX_NUM_OF_PIPES) || (size > RF24_MAX_PAYLOAD_SIZE)) {
+        return RF24_INVALID_PARAMETERS;
+    }
 
-    platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_SETUP_RETR, reg.value);
+    p_dev->pipe_payload_size[pipe_number] = size;
+
+    platform_status =
+        rf24_write_reg8(p_dev, m_child_payload_size[pipe_number], rf24_get_pipe_payload_size(p_dev, pipe_number));
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+    return dev_status;
+}
+
+rf24_status_t rf24_enable_ack_payload(rf24_dev_t* p_dev, bool enable) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    nrf24l01_reg_feature_t reg_feature;
+    nrf24l01_reg_dynpd_t reg_dynpd;
+
+    platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_FEATURE, &(reg_feature.value));
     dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+    if (dev_status == RF24_SUCCESS) {
+        reg_feature.en_ack_pay = enable ? 1 : 0;
+        reg_feature.en_dpl = enable ? 1 : 0;
+
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_FEATURE, reg_feature.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        reg_dynpd.value = enable ? (_BV(DPL_P0) | _BV(DPL_P1) | _BV(DPL_P2) | _BV(DPL_P3) | _BV(DPL_P4) | _BV(DPL_P5))
+                                 : 0x00;
+
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_DYNPD, reg_dynpd.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
     return dev_status;
 }
 
@@ -306,8 +1154,6 @@ rf24_status_t rf24_set_datarate(rf24_dev_t* p_dev, rf24_datarate_t datarate) {
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
-    //! @todo Use m_tx_delay
-
     switch (datarate) {
         case RF24_1MBPS: {
             reg_rf_setup.rf_dr_low = 0;
@@ -329,7 +1175,7 @@ rf24_status_t rf24_set_datarate(rf24_dev_t* p_dev, rf24_datarate_t datarate) {
     }
 
     if (dev_status == RF24_SUCCESS) {
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_RF_SETUP, reg_rf_setup.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_RF_SETUP, reg_rf_setup.value);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
@@ -345,6 +1191,10 @@ rf24_status_t rf24_set_datarate(rf24_dev_t* p_dev, rf24_datarate_t datarate) {
         }
     }
 
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_apply_retries(p_dev);
+    }
+
     return dev_status;
 }
 
@@ -362,7 +1212,7 @@ rf24_status_t rf24_set_output_power(rf24_dev_t* p_dev, rf24_output_power_t outpu
 
     if (dev_status == RF24_SUCCESS) {
         reg_rf_setup.rf_pwr = (uint8_t) output_power;
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_RF_SETUP, reg_rf_setup.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_RF_SETUP, reg_rf_setup.value);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
@@ -405,18 +1255,16 @@ rf24_status_t rf24_open_writing_pipe(rf24_dev_t* p_dev, uint8_t* address) {
     rf24_status_t dev_status = RF24_SUCCESS;
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
 
-    platform_status = rf24_platform_write_register(&(p_dev->platform_setup), NRF24L01_REG_RX_ADDR_P0, address,
-                                                   p_dev->addr_width);
+    platform_status = rf24_write_register(p_dev, NRF24L01_REG_RX_ADDR_P0, address, p_dev->addr_width);
     dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
 
     if (dev_status == RF24_SUCCESS) {
-        platform_status = rf24_platform_write_register(&(p_dev->platform_setup), NRF24L01_REG_TX_ADDR, address,
-                                                    p_dev->addr_width);
+        platform_status = rf24_write_register(p_dev, NRF24L01_REG_TX_ADDR, address, p_dev->addr_width);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
     if (dev_status == RF24_SUCCESS) {
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_RX_PW_P0, p_dev->payload_size);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_RX_PW_P0, p_dev->payload_size);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
@@ -437,17 +1285,16 @@ rf24_status_t rf24_open_reading_pipe(rf24_dev_t* p_dev, uint8_t pipe_number, uin
     if (pipe_number < MAX_NUM_OF_PIPES) {
         // For pipes 2-5, only write the LSB
         if (pipe_number <= 1) {
-            platform_status = rf24_platform_write_register(&(p_dev->platform_setup), m_child_pipe[pipe_number], address,
-                                                           p_dev->addr_width);
+            platform_status = rf24_write_register(p_dev, m_child_pipe[pipe_number], address, p_dev->addr_width);
         } else {
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), m_child_pipe[pipe_number], address[0]);
+            platform_status = rf24_write_reg8(p_dev, m_child_pipe[pipe_number], address[0]);
         }
 
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
 
         if (dev_status == RF24_SUCCESS) {
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), m_child_payload_size[pipe_number],
-                                                    p_dev->payload_size);
+            platform_status = rf24_write_reg8(p_dev, m_child_payload_size[pipe_number],
+                                              rf24_get_pipe_payload_size(p_dev, pipe_number));
             dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
         }
     } else {
@@ -467,8 +1314,7 @@ rf24_status_t rf24_open_reading_pipe(rf24_dev_t* p_dev, uint8_t pipe_number, uin
 
     if (dev_status == RF24_SUCCESS) {
         reg_en_rx_addr.value |= _BV(m_child_pipe_enable[pipe_number]);
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_EN_RXADDR,
-                                                   reg_en_rx_addr.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_EN_RXADDR, reg_en_rx_addr.value);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
@@ -489,8 +1335,7 @@ rf24_status_t rf24_close_reading_pipe(rf24_dev_t* p_dev, uint8_t pipe_number) {
 
     if (dev_status == RF24_SUCCESS) {
         reg_en_rx_addr.value &= (~_BV(m_child_pipe_enable[pipe_number]));
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_EN_RXADDR,
-                                                   reg_en_rx_addr.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_EN_RXADDR, reg_en_rx_addr.value);
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
@@ -498,12 +1343,15 @@ rf24_status_t rf24_close_reading_pipe(rf24_dev_t* p_dev, uint8_t pipe_number) {
 }
 
 rf24_status_t rf24_start_listening(rf24_dev_t* p_dev) {
+    RF24_HISTOGRAM_START(start_us);
     rf24_status_t dev_status = RF24_SUCCESS;
 
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
     nrf24l01_reg_config_t reg_config;
     nrf24l01_reg_status_t reg_status;
 
+    dev_status = rf24_wake_up(p_dev);
+
     if (dev_status == RF24_SUCCESS) {
         platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, &(reg_config.value));
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
@@ -512,7 +1360,7 @@ rf24_status_t rf24_start_listening(rf24_dev_t* p_dev) {
         reg_status.value = (_BV(RX_DR) | _BV(TX_DS) | _BV(MAX_RT));
 
         if (dev_status == RF24_SUCCESS) {
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, reg_config.value);
+            platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_CONFIG, reg_config.value);
             dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
 
             if (dev_status == RF24_SUCCESS) {
@@ -524,8 +1372,8 @@ rf24_status_t rf24_start_listening(rf24_dev_t* p_dev) {
 
     if (dev_status == RF24_SUCCESS) {
         if (p_dev->pipe0_reading_address[0] > 0) {
-            platform_status = rf24_platform_write_register(&(p_dev->platform_setup), NRF24L01_REG_RX_ADDR_P0,
-                                                           p_dev->pipe0_reading_address, p_dev->addr_width);
+            platform_status = rf24_write_register(p_dev, NRF24L01_REG_RX_ADDR_P0, p_dev->pipe0_reading_address,
+                                                  p_dev->addr_width);
             dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
         } else {
             dev_status = rf24_close_reading_pipe(p_dev, 0);
@@ -554,16 +1402,24 @@ rf24_status_t rf24_start_listening(rf24_dev_t* p_dev) {
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
     }
 
+    if (dev_status == RF24_SUCCESS) {
+        rf24_set_power_state(p_dev, RF24_RX_MODE);
+    }
+
+    RF24_HISTOGRAM_RECORD(RF24_HISTOGRAM_START_LISTENING, start_us);
+
     return dev_status;
 }
 
 rf24_status_t rf24_stop_listening(rf24_dev_t* p_dev) {
+    RF24_HISTOGRAM_START(start_us);
     rf24_status_t dev_status = RF24_SUCCESS;
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
 
     rf24_platform_disable(&(p_dev->platform_setup));
+    rf24_set_power_state(p_dev, RF24_STANDBY_I);
 
-    rf24_delay(m_tx_delay);
+    rf24_delay_us(rf24_get_tx_delay_us(p_dev));
 
     dev_status = rf24_flush_rx(p_dev);
 
@@ -575,7 +1431,7 @@ rf24_status_t rf24_stop_listening(rf24_dev_t* p_dev) {
     }
 
     if (reg_feature.en_ack_pay) {
-        rf24_delay(m_tx_delay);  // 250
+        rf24_delay_us(rf24_get_tx_delay_us(p_dev));
 
         if (dev_status == RF24_SUCCESS) {
             dev_status = rf24_flush_tx(p_dev);
@@ -589,7 +1445,7 @@ rf24_status_t rf24_stop_listening(rf24_dev_t* p_dev) {
 
         if (dev_status == RF24_SUCCESS) {
             reg_config.value &= (~_BV(PRIM_RX));
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, reg_config.value);
+            platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_CONFIG, reg_config.value);
             dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
         }
     }
@@ -602,12 +1458,13 @@ rf24_status_t rf24_stop_listening(rf24_dev_t* p_dev) {
         reg_en_rx_addr.value |= _BV(m_child_pipe_enable[0]);
 
         if (dev_status == RF24_SUCCESS) {
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_EN_RXADDR,
-                                                       reg_en_rx_addr.value);
+            platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_EN_RXADDR, reg_en_rx_addr.value);
             dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
         }
     }
 
+    RF24_HISTOGRAM_RECORD(RF24_HISTOGRAM_STOP_LISTENING, start_us);
+
     return dev_status;
 }
 
@@ -648,7 +1505,11 @@ rf24_status_t rf24_read(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len) {
 
     nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
 
-    platform_status = rf24_platform_read_payload(&(p_dev->platform_setup), buff, len);
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t* p_payload = p_dev->seq_enabled ? (payload) : (buff);
+    uint8_t payload_len = p_dev->seq_enabled ? (p_dev->payload_size) : (len);
+
+    platform_status = rf24_platform_read_payload(&(p_dev->platform_setup), p_payload, payload_len);
     dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
 
     // Clears data ready interruption bit. But data ready utility still not implemented.
@@ -658,89 +1519,357 @@ rf24_status_t rf24_read(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len) {
         dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
     }
 
+    if ((dev_status == RF24_SUCCESS) && (status_reg.rx_p_no < MAX_NUM_OF_PIPES)) {
+        rf24_track_rx(p_dev, status_reg.rx_p_no);
+        rf24_track_rx_drained(p_dev);
+    }
+
+    if ((dev_status == RF24_SUCCESS) && p_dev->seq_enabled && (status_reg.rx_p_no < MAX_NUM_OF_PIPES)) {
+        if (rf24_seq_accept(&(p_dev->seq_windows[status_reg.rx_p_no]), payload[0])) {
+            memcpy(buff, &(payload[RF24_SEQ_HEADER_SIZE]), p_dev->payload_size - RF24_SEQ_HEADER_SIZE);
+        } else {
+            dev_status = RF24_DUPLICATE;
+        }
+    }
+
     return dev_status;
 }
 
-rf24_status_t rf24_write(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack) {
+rf24_status_t rf24_read_next(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size) {
     rf24_status_t dev_status = RF24_SUCCESS;
-    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
-
-    nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
 
-    if (status_reg.tx_full) {
-        return RF24_TX_FIFO_FULL;
+    if (!p_dev->seq_enabled) {
+        return rf24_read_payload(p_dev, buff, len, p_pipe, p_size);
     }
 
-    platform_status = rf24_platform_write_payload(&(p_dev->platform_setup), buff, len, enable_auto_ack);
-    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
-
-    if (dev_status == RF24_SUCCESS) {
-        rf24_platform_enable(&(p_dev->platform_setup));
-    }
+    uint8_t payload_len = (len < RF24_MAX_PAYLOAD_SIZE) ? (uint8_t) (len + RF24_SEQ_HEADER_SIZE) : (RF24_MAX_PAYLOAD_SIZE);
 
     do {
-        status_reg = rf24_get_status(p_dev);
-    } while (!status_reg.tx_ds && !status_reg.max_rt);
+        dev_status = rf24_read_payload(p_dev, payload, payload_len, p_pipe, p_size);
+    } while ((dev_status == RF24_SUCCESS) &&
+             ((*p_size < RF24_SEQ_HEADER_SIZE) || !rf24_seq_accept(&(p_dev->seq_windows[*p_pipe]), payload[0])));
 
     if (dev_status == RF24_SUCCESS) {
-        rf24_platform_disable(&(p_dev->platform_setup));
+        (*p_size) -= RF24_SEQ_HEADER_SIZE;
+        memcpy(buff, &(payload[RF24_SEQ_HEADER_SIZE]), *p_size);
     }
 
-    if (dev_status == RF24_SUCCESS) {
-        // Max retries exceeded
-        if (status_reg.max_rt) {
-            dev_status = RF24_MAX_RETRANSMIT;
+    return dev_status;
+}
 
-            status_reg.max_rt = 1;  // Datasheet says to write 1 to clear the interruption bit.
-            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
-            dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+rf24_status_t rf24_read_timeout(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size,
+                                uint32_t timeout_us) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint32_t start_us = rf24_get_time_us();
 
-            if (dev_status == RF24_SUCCESS) {
-                dev_status = rf24_flush_tx(p_dev);  // Only going to be 1 packet in the FIFO at a time using this method, so just flush.
-            }
+    do {
+        dev_status = rf24_read_next(p_dev, buff, len, p_pipe, p_size);
 
+        if (dev_status != RF24_RX_FIFO_EMPTY) {
             return dev_status;
         }
-    }
 
-    if (dev_status == RF24_SUCCESS) {
-        status_reg.tx_ds = 1;
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
-        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
-    }
+        // With the receiver interruption masked the pin never asserts, so it is only waited on when enabled
+        if (!p_dev->reg_image.config.mask_rx_dr && !rf24_wait_irq(p_dev, start_us, timeout_us)) {
+            break;
+        }
+    } while (!rf24_deadline_passed(start_us, timeout_us));
 
-    return dev_status;
+    return RF24_TIMEOUT;
 }
 
-rf24_status_t rf24_write_continuously(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len) {
+rf24_status_t rf24_write(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack) {
+    return rf24_write_timeout(p_dev, buff, len, enable_auto_ack, RF24_NO_TIMEOUT, RF24_TIMEOUT_FLUSH);
+}
+
+rf24_status_t rf24_write_timeout(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack,
+                                 uint32_t timeout_us, rf24_timeout_policy_t policy) {
     rf24_status_t dev_status = RF24_SUCCESS;
     rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
 
+    dev_status = rf24_wake_up(p_dev);
+
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
+    }
+
     nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
 
     if (status_reg.tx_full) {
         return RF24_TX_FIFO_FULL;
     }
 
-    if (dev_status == RF24_SUCCESS) {
-        dev_status = rf24_set_retries(p_dev, NUM_OF_RETRANSMISSIONS_DELAY_STEPS, 0);
-    }
+    // A payload that timed out may still have raised a flag after the call returned
+    platform_status =
+        rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, _BV(TX_DS) | _BV(MAX_RT));
 
-    if (dev_status == RF24_SUCCESS) {
-        platform_status = rf24_platform_write_payload(&(p_dev->platform_setup), buff, len, false);
-        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    if (platform_status != RF24_PLATFORM_SUCCESS) {
+        return RF24_INTERRUPT_NOT_CLEARED;
     }
 
-    if (dev_status == RF24_SUCCESS) {
-        rf24_platform_enable(&(p_dev->platform_setup));
-    }
+    RF24_HISTOGRAM_START(start_us);
+    uint32_t load_us = rf24_get_time_us();
+    dev_status = rf24_load_payload(p_dev, buff, len, enable_auto_ack);
 
-    if (dev_status == RF24_SUCCESS) {
-        platform_status = rf24_platform_send_command(&(p_dev->platform_setup), NRF24L01_COMM_REUSE_TX_PL);
-        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
     }
 
-    return dev_status;
+    rf24_platform_enable(&(p_dev->platform_setup));
+    rf24_set_power_state(p_dev, RF24_TX_MODE);
+
+    do {
+        if (!rf24_wait_irq(p_dev, load_us, timeout_us)) {
+            dev_status = RF24_TIMEOUT;
+            break;
+        }
+
+        status_reg = rf24_get_status(p_dev);
+
+        // A failed read has every flag set, it must not pass as the end of the transmission
+        if (status_reg.value == STATUS_REG_ERROR_VALUE) {
+            dev_status = RF24_ERROR_CONTROL_INTERFACE;
+        } else if (status_reg.tx_ds && !status_reg.max_rt) {
+            // A payload retained on a timeout is sent first, this one is sent once the FIFO is empty
+            nrf24l01_reg_fifo_status_t reg_fifo_status;
+
+            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, _BV(TX_DS));
+
+            if (platform_status == RF24_PLATFORM_SUCCESS) {
+                platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_FIFO_STATUS,
+                                                          &(reg_fifo_status.value));
+            }
+
+            if (platform_status != RF24_PLATFORM_SUCCESS) {
+                dev_status = RF24_ERROR_CONTROL_INTERFACE;
+            } else if (!reg_fifo_status.tx_empty) {
+                status_reg.tx_ds = 0;
+            }
+        }
+
+        if ((dev_status == RF24_SUCCESS) && !status_reg.tx_ds && !status_reg.max_rt &&
+            rf24_deadline_passed(load_us, timeout_us)) {
+            dev_status = RF24_TIMEOUT;
+        }
+    } while ((dev_status == RF24_SUCCESS) && !status_reg.tx_ds && !status_reg.max_rt);
+
+    RF24_HISTOGRAM_RECORD(RF24_HISTOGRAM_WRITE, start_us);
+
+    rf24_platform_disable(&(p_dev->platform_setup));
+    rf24_set_power_state(p_dev, RF24_STANDBY_I);
+
+    if (dev_status == RF24_TIMEOUT) {
+        if (policy == RF24_TIMEOUT_FLUSH) {
+            dev_status = rf24_flush_tx(p_dev);
+        } else {
+            dev_status = RF24_SUCCESS;
+        }
+
+        if (dev_status == RF24_SUCCESS) {
+            platform_status =
+                rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, _BV(TX_DS) | _BV(MAX_RT));
+            dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
+        }
+
+        return (dev_status == RF24_SUCCESS) ? (RF24_TIMEOUT) : (dev_status);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        // Max retries exceeded
+        rf24_track_tx(p_dev, !status_reg.max_rt);
+
+        if (status_reg.max_rt) {
+            dev_status = RF24_MAX_RETRANSMIT;
+
+            status_reg.max_rt = 1;  // Datasheet says to write 1 to clear the interruption bit.
+            platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
+            dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+            if (dev_status == RF24_SUCCESS) {
+                dev_status = rf24_flush_tx(p_dev);  // Only going to be 1 packet in the FIFO at a time using this method, so just flush.
+            }
+
+            return (dev_status == RF24_SUCCESS) ? (RF24_MAX_RETRANSMIT) : (dev_status);
+        }
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        status_reg.tx_ds = 1;
+        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_write_fast(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    dev_status = rf24_wake_up(p_dev);
+
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
+    }
+
+    nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
+
+    if (status_reg.tx_full) {
+        return RF24_TX_FIFO_FULL;
+    }
+
+    dev_status = rf24_load_payload(p_dev, buff, len, enable_auto_ack);
+
+    if (dev_status == RF24_SUCCESS) {
+        rf24_platform_enable(&(p_dev->platform_setup));
+        rf24_set_power_state(p_dev, RF24_TX_MODE);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_tx_standby(rf24_dev_t* p_dev) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    nrf24l01_reg_fifo_status_t reg_fifo_status;
+    nrf24l01_reg_status_t status_reg;
+
+    while (true) {
+        status_reg = rf24_get_status(p_dev);
+
+        platform_status =
+            rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_FIFO_STATUS, &(reg_fifo_status.value));
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+        if ((dev_status != RF24_SUCCESS) || reg_fifo_status.tx_empty || status_reg.max_rt) {
+            break;
+        }
+
+        // The pin only asserts on a new flag, so it is waited for only with none pending
+        if (status_reg.tx_ds) {
+            // Each payload sent asserts the pin, it is released to wait for the next one
+            if (p_dev->wait_mode == RF24_WAIT_IRQ_PIN) {
+                rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, _BV(TX_DS));
+            }
+        } else {
+            rf24_wait_irq(p_dev, 0, RF24_NO_TIMEOUT);
+        }
+    }
+
+    rf24_platform_disable(&(p_dev->platform_setup));
+    rf24_set_power_state(p_dev, RF24_STANDBY_I);
+
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
+    }
+
+    rf24_track_tx(p_dev, reg_fifo_status.tx_empty);
+
+    // Datasheet says to write 1 to clear the interruption bits, the receiver one is kept.
+    status_reg.value = (_BV(TX_DS) | _BV(MAX_RT));
+    platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
+
+    if (reg_fifo_status.tx_empty) {
+        return dev_status;
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_flush_tx(p_dev);
+    }
+
+    return (dev_status == RF24_SUCCESS) ? (RF24_MAX_RETRANSMIT) : (dev_status);
+}
+
+rf24_status_t rf24_tx_abort(rf24_dev_t* p_dev) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    rf24_platform_disable(&(p_dev->platform_setup));
+    rf24_set_power_state(p_dev, RF24_STANDBY_I);
+
+    dev_status = rf24_flush_tx(p_dev);
+
+    if (dev_status == RF24_SUCCESS) {
+        platform_status =
+            rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, _BV(TX_DS) | _BV(MAX_RT));
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_write_continuously(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    dev_status = rf24_wake_up(p_dev);
+
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
+    }
+
+    nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
+
+    if (status_reg.tx_full) {
+        return RF24_TX_FIFO_FULL;
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_write_retries(p_dev, p_dev->retry_delay_steps, 0);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_load_payload(p_dev, buff, len, false);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        rf24_platform_enable(&(p_dev->platform_setup));
+        rf24_set_power_state(p_dev, RF24_TX_MODE);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        platform_status = rf24_platform_send_command(&(p_dev->platform_setup), NRF24L01_COMM_REUSE_TX_PL);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_stop_write_continuously(rf24_dev_t* p_dev) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    rf24_platform_disable(&(p_dev->platform_setup));
+    rf24_set_power_state(p_dev, RF24_STANDBY_I);
+
+    dev_status = rf24_flush_tx(p_dev);
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_apply_retries(p_dev);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_write_ack_payload(rf24_dev_t* p_dev, uint8_t pipe_number, uint8_t* buff, uint8_t len) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    if ((pipe_number >= MAX_NUM_OF_PIPES) || (len > RF24_MAX_PAYLOAD_SIZE)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
+
+    if (status_reg.tx_full) {
+        return RF24_TX_FIFO_FULL;
+    }
+
+    platform_status = rf24_platform_write_ack_payload(&(p_dev->platform_setup), pipe_number, buff, len);
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+    return dev_status;
 }
 
 nrf24l01_reg_status_t rf24_get_status(rf24_dev_t* p_dev) {
@@ -762,11 +1891,12 @@ rf24_status_t rf24_set_irq_configuration(rf24_dev_t* p_dev, rf24_irq_t irq_confi
         rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, &(config_reg.value));
 
     if (platform_status == RF24_PLATFORM_SUCCESS) {
-        config_reg.mask_max_rt = irq_config.max_retransmits;
-        config_reg.mask_tx_ds = irq_config.tx_data_sent;
-        config_reg.mask_rx_dr = irq_config.rx_data_ready;
+        // A mask bit set keeps the interruption off the IRQ pin
+        config_reg.mask_max_rt = !irq_config.max_retransmits;
+        config_reg.mask_tx_ds = !irq_config.tx_data_sent;
+        config_reg.mask_rx_dr = !irq_config.rx_data_ready;
 
-        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, config_reg.value);
+        platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_CONFIG, config_reg.value);
     }
 
     dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
@@ -774,6 +1904,55 @@ rf24_status_t rf24_set_irq_configuration(rf24_dev_t* p_dev, rf24_irq_t irq_confi
     return dev_status;
 }
 
+rf24_status_t rf24_set_wait_mode(rf24_dev_t* p_dev, rf24_wait_mode_t wait_mode) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    if (wait_mode == RF24_WAIT_IRQ_PIN) {
+        nrf24l01_reg_config_t config_reg;
+
+        rf24_platform_status_t platform_status =
+            rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_CONFIG, &(config_reg.value));
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+        if (dev_status == RF24_SUCCESS) {
+            rf24_irq_t irq_config = {
+                .tx_data_sent = 1,
+                .rx_data_ready = !config_reg.mask_rx_dr,
+                .max_retransmits = 1,
+            };
+
+            dev_status = rf24_set_irq_configuration(p_dev, irq_config);
+        }
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        p_dev->wait_mode = wait_mode;
+    }
+
+    return dev_status;
+}
+
+void rf24_set_callbacks(rf24_dev_t* p_dev, const rf24_callbacks_t* p_callbacks) {
+    if (p_callbacks == NULL) {
+        memset(&(p_dev->callbacks), 0, sizeof(p_dev->callbacks));
+    } else {
+        p_dev->callbacks = *p_callbacks;
+    }
+}
+
+void rf24_set_irq_edge_time(rf24_dev_t* p_dev, uint32_t edge_us) {
+    p_dev->timestamps.irq_edge_us = edge_us;
+    p_dev->timestamps.irq_edge_valid = true;
+}
+
+uint32_t rf24_get_rx_timestamp_us(rf24_dev_t* p_dev) {
+    return p_dev->timestamps.rx_us;
+}
+
+uint32_t rf24_get_tx_timestamp_us(rf24_dev_t* p_dev) {
+    return p_dev->timestamps.tx_done_us;
+}
+
 rf24_irq_t rf24_irq_callback(rf24_dev_t* p_dev) {
     rf24_irq_t irq_values = {
         .tx_data_sent = 0,
@@ -789,11 +1968,426 @@ rf24_irq_t rf24_irq_callback(rf24_dev_t* p_dev) {
         irq_values.rx_data_ready = status_reg.rx_dr;
         irq_values.max_retransmits = status_reg.max_rt;
 
+        if (status_reg.rx_dr) {
+            p_dev->timestamps.rx_ready_us = rf24_event_time_us(p_dev);
+            p_dev->timestamps.rx_ready_valid = true;
+        }
+
+        if (status_reg.tx_ds || status_reg.max_rt) {
+            rf24_track_tx(p_dev, !status_reg.max_rt);
+        }
+
         // Resets interruptions flags values
         rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
+
+        rf24_dispatch_callbacks(p_dev, status_reg);
     }
 
+    p_dev->timestamps.irq_edge_valid = false;
+
     return irq_values;
 }
 
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static rf24_platform_status_t rf24_write_register(rf24_dev_t* p_dev, nrf24l01_registers_t reg, uint8_t* buff,
+                                                  uint8_t len) {
+    rf24_platform_status_t platform_status = rf24_platform_write_register(&(p_dev->platform_setup), reg, buff, len);
+    const rf24_config_entry_t* p_entry = rf24_find_config_entry(reg);
+
+    if ((platform_status == RF24_PLATFORM_SUCCESS) && (p_entry != NULL)) {
+        memcpy(((uint8_t*) &(p_dev->reg_image)) + p_entry->offset, buff, (len < p_entry->size) ? len : p_entry->size);
+    }
+
+    return platform_status;
+}
+
+static rf24_platform_status_t rf24_write_reg8(rf24_dev_t* p_dev, nrf24l01_registers_t reg, uint8_t value) {
+    return rf24_write_register(p_dev, reg, &value, 1);
+}
+
+static const rf24_config_entry_t* rf24_find_config_entry(nrf24l01_registers_t reg) {
+    for (uint8_t i = 0; i < NUM_OF_CONFIG_ENTRIES; i++) {
+        if (m_config_entries[i].reg == reg) {
+            return &(m_config_entries[i]);
+        }
+    }
+
+    return NULL;
+}
+
+static rf24_status_t rf24_write_retries(rf24_dev_t* p_dev, uint8_t delay_steps, uint8_t rt_count) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    nrf24l01_reg_setup_retr_t reg;
+    reg.ard = delay_steps;
+    reg.arc = rt_count;
+
+    platform_status = rf24_write_reg8(p_dev, NRF24L01_REG_SETUP_RETR, reg.value);
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    return dev_status;
+}
+
+static rf24_status_t rf24_apply_retries(rf24_dev_t* p_dev) {
+    if (p_dev->retry_mode == RF24_RETRY_DELAY_AUTO) {
+        p_dev->retry_delay_steps = rf24_get_min_retry_delay_steps(p_dev);
+    }
+
+    return rf24_write_retries(p_dev, p_dev->retry_delay_steps, p_dev->retransmit_count);
+}
+
+static void rf24_set_power_state(rf24_dev_t* p_dev, rf24_power_state_t state) {
+    rf24_power_manager_t* p_power = &(p_dev->power);
+    uint32_t now_us = rf24_get_time_us();
+
+    p_power->residency_us[p_power->state] += now_us - p_power->state_entry_us;
+    p_power->state_entry_us = now_us;
+    p_power->last_activity_us = now_us;
+    p_power->state = state;
+}
+
+static rf24_status_t rf24_wake_up(rf24_dev_t* p_dev) {
+    if (p_dev->power.state != RF24_POWER_DOWN) {
+        return RF24_SUCCESS;
+    }
+
+    return rf24_power_up(p_dev);
+}
+
+static void rf24_delay_us(uint32_t us) {
+    rf24_delay((us + 999) / 1000);
+}
+
+static void rf24_build_init_config(rf24_dev_t* p_dev, rf24_config_t* p_config) {
+    rf24_build_config(p_dev, p_config);
+
+    p_config->config.value = 0x00;
+    rf24_fill_crc_config(p_dev->crc_length, &(p_config->config));
+    p_config->config.pwr_up = 1;
+
+    p_config->feature.value = 0x00;
+    p_config->feature.en_dyn_ack = 1;
+    p_config->dynpd.value = 0x00;
+}
+
+static void rf24_fill_crc_config(rf24_crc_length_t crc_length, nrf24l01_reg_config_t* p_reg_config) {
+    p_reg_config->en_crc = (crc_length != RF24_CRC_DISABLED) ? 1 : 0;
+    p_reg_config->crco = (crc_length == RF24_CRC_16_BITS) ? 1 : 0;
+}
+
+static rf24_status_t rf24_validate_pipe_addresses(rf24_dev_t* p_dev, uint8_t addr_width) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    nrf24l01_reg_en_rxaddr_t reg_en_rx_addr;
+    uint8_t addresses[MAX_NUM_OF_PIPES][RF24_ADDRESS_MAX_SIZE];
+
+    platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_EN_RXADDR, &(reg_en_rx_addr.value));
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+    // Pipes 0 and 1 have full addresses, pipes 2 to 5 share the MSBytes of pipe 1
+    for (uint8_t i = 0; (i <= 1) && (dev_status == RF24_SUCCESS); i++) {
+        platform_status = rf24_platform_read_register(&(p_dev->platform_setup), m_child_pipe[i], addresses[i],
+                                                      RF24_ADDRESS_MAX_SIZE);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    for (uint8_t i = 2; (i < MAX_NUM_OF_PIPES) && (dev_status == RF24_SUCCESS); i++) {
+        memcpy(addresses[i], addresses[1], RF24_ADDRESS_MAX_SIZE);
+        platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), m_child_pipe[i], &(addresses[i][0]));
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    for (uint8_t i = 0; (i < MAX_NUM_OF_PIPES) && (dev_status == RF24_SUCCESS); i++) {
+        if (!(reg_en_rx_addr.value & _BV(m_child_pipe_enable[i]))) {
+            continue;
+        }
+
+        for (uint8_t j = i + 1; j < MAX_NUM_OF_PIPES; j++) {
+            if ((reg_en_rx_addr.value & _BV(m_child_pipe_enable[j])) &&
+                (memcmp(addresses[i], addresses[j], addr_width) == 0)) {
+                dev_status = RF24_INVALID_PARAMETERS;
+                break;
+            }
+        }
+    }
+
+    return dev_status;
+}
+
+static uint32_t rf24_frame_airtime_us(rf24_dev_t* p_dev, uint8_t payload_len) {
+    uint32_t bits = 8 * (PREAMBLE_SIZE_BYTES + p_dev->addr_width + payload_len + (uint8_t) p_dev->crc_length) +
+                    PACKET_CONTROL_FIELD_BITS;
+
+    return rf24_bits_to_us(p_dev->datarate, bits);
+}
+
+static uint32_t rf24_bits_to_us(rf24_datarate_t datarate, uint32_t bits) {
+    switch (datarate) {
+        case RF24_2MBPS: {
+            return (bits + 1) / 2;
+        }
+
+        case RF24_250KBPS: {
+            return bits * 4;
+        }
+
+        case RF24_1MBPS:
+        default: {
+            return bits;
+        }
+    }
+}
+
+static uint32_t rf24_get_tx_delay_us(rf24_dev_t* p_dev) {
+    return RX_TX_SETTLING_TIME_US + rf24_frame_airtime_us(p_dev, p_dev->ack_payload_size);
+}
+
+static uint8_t rf24_get_pipe_payload_size(rf24_dev_t* p_dev, uint8_t pipe_number) {
+    return (p_dev->pipe_payload_size[pipe_number] > 0) ? (p_dev->pipe_payload_size[pipe_number]) : (p_dev->payload_size);
+}
+
+static rf24_status_t rf24_read_payload(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, uint8_t* p_pipe,
+                                       uint8_t* p_size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+
+    nrf24l01_reg_dynpd_t reg_dynpd;
+    uint8_t size = 0;
+
+    nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
+
+    // Pipe number is all ones when the FIFO is empty
+    if (status_reg.rx_p_no >= MAX_NUM_OF_PIPES) {
+        p_dev->timestamps.rx_ready_valid = false;
+        return RF24_RX_FIFO_EMPTY;
+    }
+
+    platform_status = rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_DYNPD, &(reg_dynpd.value));
+    dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+    if (dev_status == RF24_SUCCESS) {
+        if (reg_dynpd.value & _BV(status_reg.rx_p_no)) {
+            platform_status = rf24_platform_read_payload_width(&(p_dev->platform_setup), &size);
+            dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+
+            // Datasheet says to flush a corrupted payload with a width over 32 bytes
+            if ((dev_status == RF24_SUCCESS) && (size > RF24_MAX_PAYLOAD_SIZE)) {
+                rf24_flush_rx(p_dev);
+                return RF24_UNKNOWN_ERROR;
+            }
+        } else {
+            size = rf24_get_pipe_payload_size(p_dev, status_reg.rx_p_no);
+        }
+    }
+
+    if ((dev_status == RF24_SUCCESS) && (len < size)) {
+        return RF24_BUFFER_TOO_SMALL;
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        platform_status = rf24_platform_read_payload(&(p_dev->platform_setup), buff, size);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        (*p_pipe) = (uint8_t) status_reg.rx_p_no;
+        (*p_size) = size;
+
+        rf24_track_rx(p_dev, status_reg.rx_p_no);
+
+        status_reg.rx_dr = 1;
+        platform_status = rf24_platform_write_reg8(&(p_dev->platform_setup), NRF24L01_REG_STATUS, status_reg.value);
+        dev_status = (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_INTERRUPT_NOT_CLEARED);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        rf24_track_rx_drained(p_dev);
+    }
+
+    return dev_status;
+}
+
+
+static rf24_status_t rf24_load_payload(rf24_dev_t* p_dev, uint8_t* buff, uint8_t len, bool enable_auto_ack) {
+    rf24_platform_status_t platform_status = RF24_PLATFORM_SUCCESS;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+
+    if (!p_dev->seq_enabled) {
+        platform_status = rf24_platform_write_payload(&(p_dev->platform_setup), buff, len, enable_auto_ack);
+        return (platform_status == RF24_PLATFORM_SUCCESS) ? (RF24_SUCCESS) : (RF24_ERROR_CONTROL_INTERFACE);
+    }
+
+    if (len > RF24_MAX_PAYLOAD_SIZE - RF24_SEQ_HEADER_SIZE) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    payload[0] = (p_dev->tx_seq & RF24_SEQ_MASK) | (enable_auto_ack ? 0 : RF24_SEQ_FLAG_NO_ACK) |
+                 (p_dev->seq_sync_pending ? RF24_SEQ_FLAG_SYNC : 0);
+    memcpy(&(payload[RF24_SEQ_HEADER_SIZE]), buff, len);
+
+    platform_status =
+        rf24_platform_write_payload(&(p_dev->platform_setup), payload, len + RF24_SEQ_HEADER_SIZE, enable_auto_ack);
+
+    if (platform_status != RF24_PLATFORM_SUCCESS) {
+        return RF24_ERROR_CONTROL_INTERFACE;
+    }
+
+    p_dev->tx_seq = (p_dev->tx_seq + 1) & RF24_SEQ_MASK;
+    p_dev->seq_sync_pending = false;
+
+    return RF24_SUCCESS;
+}
+
+static bool rf24_seq_accept(rf24_seq_window_t* p_window, uint8_t header) {
+    uint8_t seq = header & RF24_SEQ_MASK;
+    uint8_t ahead = (seq - p_window->last_seq) & RF24_SEQ_MASK;
+    uint8_t behind = (p_window->last_seq - seq) & RF24_SEQ_MASK;
+    bool sync = (header & RF24_SEQ_FLAG_SYNC) != 0;
+
+    // A sync payload only repeats the last one when that carried the flag too, otherwise the sender restarted
+    if (p_window->valid && (ahead == 0) && (!sync || p_window->last_sync)) {
+        p_window->duplicates++;
+        return false;
+    }
+
+    if (!p_window->valid || sync) {
+        p_window->last_seq = seq;
+        p_window->history = 1;
+        p_window->last_sync = sync;
+        p_window->valid = true;
+    } else if (ahead <= SEQ_HALF_RANGE) {
+        p_window->gaps += ahead - 1;
+        p_window->history = (ahead < SEQ_WINDOW_SIZE) ? ((p_window->history << ahead) | 1) : 1;
+        p_window->last_seq = seq;
+        p_window->last_sync = false;
+    } else if (behind < SEQ_WINDOW_SIZE) {
+        if (p_window->history & (1U << behind)) {
+            p_window->duplicates++;
+            return false;
+        }
+
+        // A late payload fills a gap counted before
+        p_window->history |= (1U << behind);
+        p_window->gaps = (p_window->gaps > 0) ? (p_window->gaps - 1) : 0;
+    } else {
+        // Too old to be in the window, the sender probably restarted
+        p_window->last_seq = seq;
+        p_window->history = 1;
+        p_window->last_sync = false;
+    }
+
+    p_window->received++;
+
+    return true;
+}
+
+static void rf24_track_rx(rf24_dev_t* p_dev, uint8_t pipe_number) {
+    uint32_t rx_us = p_dev->timestamps.rx_ready_valid ? (p_dev->timestamps.rx_ready_us) : (rf24_get_time_us());
+
+    if (p_dev->timestamps.rx_ready_valid) {
+        RF24_HISTOGRAM_RECORD(RF24_HISTOGRAM_RX_LATENCY, rx_us);
+    }
+
+    p_dev->timestamps.rx_us = rx_us;
+    p_dev->link.last_rx_us[pipe_number] = rx_us;
+    p_dev->link.rx_count[pipe_number]++;
+}
+
+static void rf24_track_tx(rf24_dev_t* p_dev, bool delivered) {
+    p_dev->timestamps.tx_done_us = rf24_event_time_us(p_dev);
+
+    if (delivered) {
+        p_dev->link.consecutive_max_rt = 0;
+    } else if (p_dev->link.consecutive_max_rt < UINT8_MAX) {
+        p_dev->link.consecutive_max_rt++;
+    }
+}
+
+static void rf24_track_rx_drained(rf24_dev_t* p_dev) {
+    if (!p_dev->timestamps.rx_ready_valid) {
+        return;
+    }
+
+    nrf24l01_reg_status_t status_reg = rf24_get_status(p_dev);
+
+    // Pipe number is all ones when the FIFO is empty
+    if (status_reg.rx_p_no >= MAX_NUM_OF_PIPES) {
+        p_dev->timestamps.rx_ready_valid = false;
+    }
+}
+
+static bool rf24_wait_irq(rf24_dev_t* p_dev, uint32_t start_us, uint32_t timeout_us) {
+    if (p_dev->wait_mode != RF24_WAIT_IRQ_PIN) {
+        return true;
+    }
+
+    while (!rf24_platform_irq_asserted(&(p_dev->platform_setup))) {
+        if (rf24_deadline_passed(start_us, timeout_us)) {
+            return false;
+        }
+
+        rf24_wait_for_event();
+    }
+
+    return true;
+}
+
+static bool rf24_deadline_passed(uint32_t start_us, uint32_t timeout_us) {
+    return (timeout_us != RF24_NO_TIMEOUT) && ((rf24_get_time_us() - start_us) >= timeout_us);
+}
+
+static void rf24_dispatch_callbacks(rf24_dev_t* p_dev, nrf24l01_reg_status_t status_reg) {
+    rf24_callbacks_t* p_callbacks = &(p_dev->callbacks);
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t pipe;
+    uint8_t size = 0;
+    bool has_ack_payload = false;
+
+    if (status_reg.rx_dr && (p_callbacks->on_fifo_overflow != NULL)) {
+        nrf24l01_reg_fifo_status_t reg_fifo_status;
+
+        if ((rf24_platform_read_reg8(&(p_dev->platform_setup), NRF24L01_REG_FIFO_STATUS, &(reg_fifo_status.value)) ==
+             RF24_PLATFORM_SUCCESS) &&
+            reg_fifo_status.rx_full) {
+            p_callbacks->on_fifo_overflow(p_callbacks->p_context);
+        }
+    }
+
+    if (status_reg.tx_ds && (p_callbacks->on_tx_done != NULL)) {
+        // ACK payloads arrive along with the data sent interruption, never with a sequence header
+        // On a receiver it means its own ACK payload was sent, the payload received goes to on_rx
+        if (status_reg.rx_dr && p_dev->reg_image.feature.en_ack_pay && !p_dev->reg_image.config.prim_rx) {
+            has_ack_payload = (rf24_read_payload(p_dev, payload, sizeof(payload), &pipe, &size) == RF24_SUCCESS);
+        }
+
+        p_callbacks->on_tx_done(p_callbacks->p_context, has_ack_payload ? (payload) : (NULL),
+                                has_ack_payload ? (size) : (0));
+    }
+
+    if (status_reg.max_rt && (p_callbacks->on_max_rt != NULL)) {
+        p_callbacks->on_max_rt(p_callbacks->p_context);
+    }
+
+    if (status_reg.rx_dr && (p_callbacks->on_rx != NULL)) {
+        while (rf24_read_next(p_dev, payload, sizeof(payload), &pipe, &size) == RF24_SUCCESS) {
+            p_callbacks->on_rx(p_callbacks->p_context, pipe, payload, size);
+        }
+    }
+}
+
+static uint32_t rf24_event_time_us(rf24_dev_t* p_dev) {
+    return p_dev->timestamps.irq_edge_valid ? (p_dev->timestamps.irq_edge_us) : (rf24_get_time_us());
+}
+
 __weak rf24_status_t rf24_delay(uint32_t ms);
+
+__weak uint32_t rf24_get_time_us(void) {
+    return 0;
+}
+
+__weak void rf24_wait_for_event(void) {
+}
@@ -0,0 +1,549 @@
+/**
+ * @file rf24_aead.c
+ *
+ * @brief nRF24L01 payload authenticated encryption, with ChaCha20-Poly1305.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_aead.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define CHACHA20_BLOCK_SIZE     64
+#define CHACHA20_NONCE_WORDS    3
+#define CHACHA20_DOUBLE_ROUNDS  10
+
+#define POLY1305_BLOCK_SIZE 16
+#define POLY1305_KEY_SIZE   32
+#define POLY1305_TAG_SIZE   16
+#define POLY1305_LIMB_MASK  0x3FFFFFF
+#define POLY1305_HIBIT      (1UL << 24)
+
+/*****************************************
+ * Private Macros
+ *****************************************/
+
+#define ROTL32(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
+
+#define QUARTER_ROUND(a, b, c, d)            \
+    do {                                     \
+        a += b; d ^= a; d = ROTL32(d, 16);   \
+        c += d; b ^= c; b = ROTL32(b, 12);   \
+        a += b; d ^= a; d = ROTL32(d, 8);    \
+        c += d; b ^= c; b = ROTL32(b, 7);    \
+    } while (0)
+
+/*****************************************
+ * Private Types
+ *****************************************/
+
+/**
+ * @brief Poly1305 state, in 26 bits limbs.
+ */
+typedef struct poly1305 {
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+} poly1305_t;
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Reads a little endian 32 bits word.
+ *
+ * @param buff Pointer to the word.
+ *
+ * @return Word value.
+ */
+static uint32_t rf24_aead_load32(const uint8_t* buff);
+
+/**
+ * @brief Writes a little endian 32 bits word.
+ *
+ * @param buff  Pointer to store the word.
+ * @param value Word value.
+ */
+static void rf24_aead_store32(uint8_t* buff, uint32_t value);
+
+/**
+ * @brief Generates a ChaCha20 keystream block.
+ *
+ * @param key     Key words.
+ * @param counter Block counter.
+ * @param nonce   Nonce words.
+ * @param block   Pointer to store the @ref CHACHA20_BLOCK_SIZE bytes block.
+ */
+static void rf24_aead_chacha20_block(const uint32_t* key, uint32_t counter, const uint32_t* nonce, uint8_t* block);
+
+/**
+ * @brief Initializes Poly1305 with its one time key.
+ *
+ * @param p_poly Pointer to Poly1305 state.
+ * @param key    Pointer to the @ref POLY1305_KEY_SIZE bytes key.
+ */
+static void rf24_aead_poly1305_init(poly1305_t* p_poly, const uint8_t* key);
+
+/**
+ * @brief Processes a full block.
+ *
+ * @param p_poly Pointer to Poly1305 state.
+ * @param block  Pointer to the @ref POLY1305_BLOCK_SIZE bytes block.
+ */
+static void rf24_aead_poly1305_block(poly1305_t* p_poly, const uint8_t* block);
+
+/**
+ * @brief Processes data zero padded to whole blocks.
+ *
+ * @param p_poly Pointer to Poly1305 state.
+ * @param buff   Pointer to the data.
+ * @param len    Data size.
+ */
+static void rf24_aead_poly1305_padded(poly1305_t* p_poly, const uint8_t* buff, uint8_t len);
+
+/**
+ * @brief Computes the tag.
+ *
+ * @param p_poly Pointer to Poly1305 state.
+ * @param tag    Pointer to store the @ref POLY1305_TAG_SIZE bytes tag.
+ */
+static void rf24_aead_poly1305_finish(poly1305_t* p_poly, uint8_t* tag);
+
+/**
+ * @brief Applies ChaCha20-Poly1305 as in RFC 8439.
+ *
+ * @param key     Key words.
+ * @param nonce   Nonce words.
+ * @param aad     Pointer to the additional data.
+ * @param aad_len Additional data size.
+ * @param in      Pointer to the plaintext or ciphertext.
+ * @param out     Pointer to store the ciphertext or plaintext, may be the same as in.
+ * @param len     Text size.
+ * @param encrypt Whether the text is the plaintext.
+ * @param tag     Pointer to store the @ref POLY1305_TAG_SIZE bytes tag.
+ */
+static void rf24_aead_chacha20_poly1305(const uint32_t* key, const uint32_t* nonce, const uint8_t* aad,
+                                        uint8_t aad_len, const uint8_t* in, uint8_t* out, uint8_t len, bool encrypt,
+                                        uint8_t* tag);
+
+/**
+ * @brief Checks a counter against the replay window of a peer.
+ *
+ * @param p_peer  Pointer to peer.
+ * @param counter Frame counter.
+ *
+ * @return Whether the counter was not accepted before.
+ */
+static bool rf24_aead_is_fresh(const rf24_aead_peer_t* p_peer, uint32_t counter);
+
+/**
+ * @brief Marks a counter as accepted.
+ *
+ * @param p_peer  Pointer to peer.
+ * @param counter Frame counter.
+ */
+static void rf24_aead_accept(rf24_aead_peer_t* p_peer, uint32_t counter);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_aead_init(rf24_aead_t* p_aead, rf24_dev_t* p_dev, const uint8_t* key, uint32_t node_id,
+                    uint32_t tx_counter) {
+    memset(p_aead, 0, sizeof(rf24_aead_t));
+
+    p_aead->p_dev = p_dev;
+    p_aead->node_id = node_id;
+    p_aead->tx_counter = tx_counter;
+
+    for (uint8_t i = 0; i < RF24_AEAD_KEY_SIZE / 4; i++) {
+        p_aead->key[i] = rf24_aead_load32(&(key[4 * i]));
+    }
+}
+
+rf24_status_t rf24_aead_set_peer(rf24_aead_t* p_aead, uint8_t pipe, uint32_t node_id) {
+    if (pipe >= RF24_NUM_OF_PIPES) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    rf24_aead_peer_t* p_peer = &(p_aead->peers[pipe]);
+
+    memset(p_peer, 0, sizeof(rf24_aead_peer_t));
+    p_peer->node_id = node_id;
+    p_peer->enabled = true;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_aead_seal(rf24_aead_t* p_aead, const uint8_t* buff, uint8_t len, uint8_t* frame,
+                             uint8_t* p_size) {
+    uint8_t tag[POLY1305_TAG_SIZE];
+
+    if ((len > RF24_MAX_PAYLOAD_SIZE - RF24_AEAD_OVERHEAD) || (p_aead->tx_counter == UINT32_MAX)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    uint32_t counter = p_aead->tx_counter++;
+    uint32_t nonce[CHACHA20_NONCE_WORDS] = {p_aead->node_id, counter, 0};
+
+    rf24_aead_store32(frame, counter);
+    rf24_aead_chacha20_poly1305(p_aead->key, nonce, NULL, 0, buff, &(frame[RF24_AEAD_COUNTER_SIZE]), len, true, tag);
+    memcpy(&(frame[RF24_AEAD_COUNTER_SIZE + len]), tag, RF24_AEAD_TAG_SIZE);
+
+    (*p_size) = len + RF24_AEAD_OVERHEAD;
+    p_aead->stats.sealed++;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_aead_open(rf24_aead_t* p_aead, uint8_t pipe, const uint8_t* frame, uint8_t size, uint8_t* buff,
+                             uint8_t* p_len) {
+    uint8_t plain[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t tag[POLY1305_TAG_SIZE];
+    uint8_t diff = 0;
+
+    if ((pipe >= RF24_NUM_OF_PIPES) || !p_aead->peers[pipe].enabled || (size < RF24_AEAD_OVERHEAD) ||
+        (size > RF24_MAX_PAYLOAD_SIZE)) {
+        p_aead->stats.rejected++;
+        return RF24_AUTHENTICATION_FAILED;
+    }
+
+    rf24_aead_peer_t* p_peer = &(p_aead->peers[pipe]);
+    uint8_t len = size - RF24_AEAD_OVERHEAD;
+    uint32_t counter = rf24_aead_load32(frame);
+    uint32_t nonce[CHACHA20_NONCE_WORDS] = {p_peer->node_id, counter, 0};
+
+    // Cheap check first, a replayed frame is authentic and would pass the tag
+    if (!rf24_aead_is_fresh(p_peer, counter)) {
+        p_aead->stats.replayed++;
+        return RF24_DUPLICATE;
+    }
+
+    rf24_aead_chacha20_poly1305(p_aead->key, nonce, NULL, 0, &(frame[RF24_AEAD_COUNTER_SIZE]), plain, len, false,
+                                tag);
+
+    // Constant time comparison, no early exit on the first wrong byte
+    for (uint8_t i = 0; i < RF24_AEAD_TAG_SIZE; i++) {
+        diff |= tag[i] ^ frame[RF24_AEAD_COUNTER_SIZE + len + i];
+    }
+
+    if (diff != 0) {
+        p_aead->stats.rejected++;
+        return RF24_AUTHENTICATION_FAILED;
+    }
+
+    rf24_aead_accept(p_peer, counter);
+
+    memcpy(buff, plain, len);
+    (*p_len) = len;
+    p_aead->stats.opened++;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_aead_write(rf24_aead_t* p_aead, uint8_t* buff, uint8_t len, bool enable_auto_ack) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t plain[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t frame[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t capacity = rf24_get_payload_capacity(p_aead->p_dev);
+    uint8_t size = 0;
+
+    if ((capacity < RF24_AEAD_OVERHEAD) || (len > capacity - RF24_AEAD_OVERHEAD)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    memcpy(plain, buff, len);
+
+    // Padded before sealing, so the tag covers the whole static payload
+    if (!p_aead->p_dev->reg_image.feature.en_dpl) {
+        memset(&(plain[len]), 0, capacity - RF24_AEAD_OVERHEAD - len);
+        len = capacity - RF24_AEAD_OVERHEAD;
+    }
+
+    dev_status = rf24_aead_seal(p_aead, plain, len, frame, &size);
+
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
+    }
+
+    return rf24_write(p_aead->p_dev, frame, size, enable_auto_ack);
+}
+
+rf24_status_t rf24_aead_read(rf24_aead_t* p_aead, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t frame[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t plain[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t frame_size = 0;
+    uint8_t plain_size = 0;
+
+    while (true) {
+        dev_status = rf24_read_next(p_aead->p_dev, frame, sizeof(frame), p_pipe, &frame_size);
+
+        if (dev_status != RF24_SUCCESS) {
+            return dev_status;
+        }
+
+        if (rf24_aead_open(p_aead, *p_pipe, frame, frame_size, plain, &plain_size) != RF24_SUCCESS) {
+            continue;
+        }
+
+        if (len < plain_size) {
+            return RF24_BUFFER_TOO_SMALL;
+        }
+
+        memcpy(buff, plain, plain_size);
+        (*p_size) = plain_size;
+
+        return RF24_SUCCESS;
+    }
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static uint32_t rf24_aead_load32(const uint8_t* buff) {
+    return (uint32_t) buff[0] | ((uint32_t) buff[1] << 8) | ((uint32_t) buff[2] << 16) | ((uint32_t) buff[3] << 24);
+}
+
+static void rf24_aead_store32(uint8_t* buff, uint32_t value) {
+    buff[0] = value;
+    buff[1] = value >> 8;
+    buff[2] = value >> 16;
+    buff[3] = value >> 24;
+}
+
+static void rf24_aead_chacha20_block(const uint32_t* key, uint32_t counter, const uint32_t* nonce, uint8_t* block) {
+    uint32_t state[16] = {
+        0x61707865, 0x3320646E, 0x79622D32, 0x6B206574,
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        counter, nonce[0], nonce[1], nonce[2],
+    };
+    uint32_t x[16];
+
+    memcpy(x, state, sizeof(x));
+
+    for (uint8_t i = 0; i < CHACHA20_DOUBLE_ROUNDS; i++) {
+        QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (uint8_t i = 0; i < 16; i++) {
+        rf24_aead_store32(&(block[4 * i]), x[i] + state[i]);
+    }
+}
+
+static void rf24_aead_poly1305_init(poly1305_t* p_poly, const uint8_t* key) {
+    // Clamped r, as in poly1305-donna
+    p_poly->r[0] = rf24_aead_load32(&(key[0])) & 0x3FFFFFF;
+    p_poly->r[1] = (rf24_aead_load32(&(key[3])) >> 2) & 0x3FFFF03;
+    p_poly->r[2] = (rf24_aead_load32(&(key[6])) >> 4) & 0x3FFC0FF;
+    p_poly->r[3] = (rf24_aead_load32(&(key[9])) >> 6) & 0x3F03FFF;
+    p_poly->r[4] = (rf24_aead_load32(&(key[12])) >> 8) & 0x00FFFFF;
+
+    memset(p_poly->h, 0, sizeof(p_poly->h));
+
+    for (uint8_t i = 0; i < 4; i++) {
+        p_poly->pad[i] = rf24_aead_load32(&(key[16 + 4 * i]));
+    }
+}
+
+static void rf24_aead_poly1305_block(poly1305_t* p_poly, const uint8_t* block) {
+    const uint32_t* r = p_poly->r;
+    uint32_t* h = p_poly->h;
+    uint32_t s1 = r[1] * 5;
+    uint32_t s2 = r[2] * 5;
+    uint32_t s3 = r[3] * 5;
+    uint32_t s4 = r[4] * 5;
+
+    h[0] += rf24_aead_load32(&(block[0])) & POLY1305_LIMB_MASK;
+    h[1] += (rf24_aead_load32(&(block[3])) >> 2) & POLY1305_LIMB_MASK;
+    h[2] += (rf24_aead_load32(&(block[6])) >> 4) & POLY1305_LIMB_MASK;
+    h[3] += (rf24_aead_load32(&(block[9])) >> 6) & POLY1305_LIMB_MASK;
+    h[4] += (rf24_aead_load32(&(block[12])) >> 8) | POLY1305_HIBIT;
+
+    uint64_t d0 = (uint64_t) h[0] * r[0] + (uint64_t) h[1] * s4 + (uint64_t) h[2] * s3 + (uint64_t) h[3] * s2 +
+                  (uint64_t) h[4] * s1;
+    uint64_t d1 = (uint64_t) h[0] * r[1] + (uint64_t) h[1] * r[0] + (uint64_t) h[2] * s4 + (uint64_t) h[3] * s3 +
+                  (uint64_t) h[4] * s2;
+    uint64_t d2 = (uint64_t) h[0] * r[2] + (uint64_t) h[1] * r[1] + (uint64_t) h[2] * r[0] + (uint64_t) h[3] * s4 +
+                  (uint64_t) h[4] * s3;
+    uint64_t d3 = (uint64_t) h[0] * r[3] + (uint64_t) h[1] * r[2] + (uint64_t) h[2] * r[1] + (uint64_t) h[3] * r[0] +
+                  (uint64_t) h[4] * s4;
+    uint64_t d4 = (uint64_t) h[0] * r[4] + (uint64_t) h[1] * r[3] + (uint64_t) h[2] * r[2] + (uint64_t) h[3] * r[1] +
+                  (uint64_t) h[4] * r[0];
+
+    uint32_t c = d0 >> 26;
+    h[0] = d0 & POLY1305_LIMB_MASK;
+    d1 += c;
+    c = d1 >> 26;
+    h[1] = d1 & POLY1305_LIMB_MASK;
+    d2 += c;
+    c = d2 >> 26;
+    h[2] = d2 & POLY1305_LIMB_MASK;
+    d3 += c;
+    c = d3 >> 26;
+    h[3] = d3 & POLY1305_LIMB_MASK;
+    d4 += c;
+    c = d4 >> 26;
+    h[4] = d4 & POLY1305_LIMB_MASK;
+    h[0] += c * 5;
+    c = h[0] >> 26;
+    h[0] &= POLY1305_LIMB_MASK;
+    h[1] += c;
+}
+
+static void rf24_aead_poly1305_padded(poly1305_t* p_poly, const uint8_t* buff, uint8_t len) {
+    uint8_t block[POLY1305_BLOCK_SIZE];
+
+    for (uint8_t offset = 0; offset < len; offset += POLY1305_BLOCK_SIZE) {
+        uint8_t size = ((len - offset) < POLY1305_BLOCK_SIZE) ? (len - offset) : POLY1305_BLOCK_SIZE;
+
+        memset(block, 0, sizeof(block));
+        memcpy(block, &(buff[offset]), size);
+        rf24_aead_poly1305_block(p_poly, block);
+    }
+}
+
+static void rf24_aead_poly1305_finish(poly1305_t* p_poly, uint8_t* tag) {
+    uint32_t* h = p_poly->h;
+    uint32_t g[5];
+    uint32_t c;
+
+    c = h[1] >> 26;
+    h[1] &= POLY1305_LIMB_MASK;
+    h[2] += c;
+    c = h[2] >> 26;
+    h[2] &= POLY1305_LIMB_MASK;
+    h[3] += c;
+    c = h[3] >> 26;
+    h[3] &= POLY1305_LIMB_MASK;
+    h[4] += c;
+    c = h[4] >> 26;
+    h[4] &= POLY1305_LIMB_MASK;
+    h[0] += c * 5;
+    c = h[0] >> 26;
+    h[0] &= POLY1305_LIMB_MASK;
+    h[1] += c;
+
+    // h - p, selected without branches when h >= p
+    g[0] = h[0] + 5;
+    c = g[0] >> 26;
+    g[0] &= POLY1305_LIMB_MASK;
+    g[1] = h[1] + c;
+    c = g[1] >> 26;
+    g[1] &= POLY1305_LIMB_MASK;
+    g[2] = h[2] + c;
+    c = g[2] >> 26;
+    g[2] &= POLY1305_LIMB_MASK;
+    g[3] = h[3] + c;
+    c = g[3] >> 26;
+    g[3] &= POLY1305_LIMB_MASK;
+    g[4] = h[4] + c - (1UL << 26);
+
+    uint32_t mask = (g[4] >> 31) - 1;
+
+    for (uint8_t i = 0; i < 5; i++) {
+        h[i] = (h[i] & ~mask) | (g[i] & mask);
+    }
+
+    uint32_t words[4] = {
+        h[0] | (h[1] << 26),
+        (h[1] >> 6) | (h[2] << 20),
+        (h[2] >> 12) | (h[3] << 14),
+        (h[3] >> 18) | (h[4] << 8),
+    };
+    uint64_t f = 0;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        f = (uint64_t) words[i] + p_poly->pad[i] + (f >> 32);
+        rf24_aead_store32(&(tag[4 * i]), f);
+    }
+}
+
+static void rf24_aead_chacha20_poly1305(const uint32_t* key, const uint32_t* nonce, const uint8_t* aad,
+                                        uint8_t aad_len, const uint8_t* in, uint8_t* out, uint8_t len, bool encrypt,
+                                        uint8_t* tag) {
+    uint8_t block[CHACHA20_BLOCK_SIZE];
+    uint8_t lengths[POLY1305_BLOCK_SIZE] = {0};
+    poly1305_t poly;
+
+    // The first block gives the Poly1305 one time key, the next ones the keystream
+    rf24_aead_chacha20_block(key, 0, nonce, block);
+    rf24_aead_poly1305_init(&poly, block);
+    rf24_aead_poly1305_padded(&poly, aad, aad_len);
+
+    if (!encrypt) {
+        rf24_aead_poly1305_padded(&poly, in, len);
+    }
+
+    for (uint8_t i = 0; i < len; i++) {
+        if ((i % CHACHA20_BLOCK_SIZE) == 0) {
+            rf24_aead_chacha20_block(key, 1 + i / CHACHA20_BLOCK_SIZE, nonce, block);
+        }
+
+        out[i] = in[i] ^ block[i % CHACHA20_BLOCK_SIZE];
+    }
+
+    if (encrypt) {
+        rf24_aead_poly1305_padded(&poly, out, len);
+    }
+
+    lengths[0] = aad_len;
+    lengths[8] = len;
+    rf24_aead_poly1305_block(&poly, lengths);
+    rf24_aead_poly1305_finish(&poly, tag);
+
+    memset(block, 0, sizeof(block));
+}
+
+static bool rf24_aead_is_fresh(const rf24_aead_peer_t* p_peer, uint32_t counter) {
+    if (!p_peer->has_counter || (counter > p_peer->last_counter)) {
+        return true;
+    }
+
+    uint32_t age = p_peer->last_counter - counter;
+
+    if ((age == 0) || (age > RF24_AEAD_REPLAY_WINDOW)) {
+        return false;
+    }
+
+    return (p_peer->window & (1UL << (age - 1))) == 0;
+}
+
+static void rf24_aead_accept(rf24_aead_peer_t* p_peer, uint32_t counter) {
+    if (!p_peer->has_counter) {
+        p_peer->has_counter = true;
+        p_peer->last_counter = counter;
+        p_peer->window = 0;
+        return;
+    }
+
+    if (counter > p_peer->last_counter) {
+        uint32_t shift = counter - p_peer->last_counter;
+
+        if (shift > RF24_AEAD_REPLAY_WINDOW) {
+            p_peer->window = 0;
+        } else {
+            // The previous newest counter becomes bit shift - 1
+            p_peer->window = ((shift == RF24_AEAD_REPLAY_WINDOW) ? 0 : (p_peer->window << shift)) |
+                             (1UL << (shift - 1));
+        }
+
+        p_peer->last_counter = counter;
+    } else {
+        p_peer->window |= 1UL << (p_peer->last_counter - counter - 1);
+    }
+}
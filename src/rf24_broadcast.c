@@ -0,0 +1,123 @@
+/**
+ * @file rf24_broadcast.c
+ *
+ * @brief nRF24L01 broadcast, with repeats and duplicate suppression.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_broadcast.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define GAP_STEP_US 250
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+rf24_status_t rf24_broadcast_init(rf24_broadcast_t* p_bc, rf24_dev_t* p_dev, uint8_t repeats, uint8_t gap_steps) {
+    if (repeats == 0) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    memset(p_bc, 0, sizeof(rf24_broadcast_t));
+
+    p_bc->p_dev = p_dev;
+    p_bc->pipe_number = RF24_NUM_OF_PIPES;
+    p_bc->repeats = repeats;
+    p_bc->gap_steps = gap_steps;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_broadcast_open_receiver(rf24_broadcast_t* p_bc, uint8_t pipe_number, uint8_t* address) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    dev_status = rf24_open_reading_pipe(p_bc->p_dev, pipe_number, address);
+
+    if (dev_status == RF24_SUCCESS) {
+        p_bc->pipe_number = pipe_number;
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_broadcast_open_transmitter(rf24_broadcast_t* p_bc, uint8_t* address) {
+    return rf24_open_writing_pipe(p_bc->p_dev, address);
+}
+
+rf24_status_t rf24_broadcast_send(rf24_broadcast_t* p_bc, uint8_t* buff, uint8_t len) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE] = {0};
+    uint8_t payload_size = rf24_get_payload_capacity(p_bc->p_dev);
+
+    if (len + RF24_BROADCAST_HEADER_SIZE > payload_size) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    payload[0] = p_bc->next_seq++;
+    memcpy(&(payload[RF24_BROADCAST_HEADER_SIZE]), buff, len);
+
+    for (uint8_t i = 0; (i < p_bc->repeats) && (dev_status == RF24_SUCCESS); i++) {
+        if ((i > 0) && (p_bc->gap_steps > 0)) {
+            uint32_t start_us = rf24_get_time_us();
+
+            while ((rf24_get_time_us() - start_us) < (uint32_t) p_bc->gap_steps * GAP_STEP_US) {
+            }
+        }
+
+        dev_status = rf24_write(p_bc->p_dev, payload, payload_size, false);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_broadcast_read(rf24_broadcast_t* p_bc, uint8_t* buff, uint8_t len, uint8_t* p_pipe,
+                                  uint8_t* p_size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t size;
+
+    while (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_read_next(p_bc->p_dev, payload, sizeof(payload), p_pipe, &size);
+
+        if (dev_status != RF24_SUCCESS) {
+            break;
+        }
+
+        uint8_t offset = 0;
+
+        if (*p_pipe == p_bc->pipe_number) {
+            if (size < RF24_BROADCAST_HEADER_SIZE) {
+                continue;
+            }
+
+            // Repeats of a payload arrive in a row, with the same sequence number
+            if (p_bc->has_last && (payload[0] == p_bc->last_seq)) {
+                p_bc->duplicates++;
+                continue;
+            }
+
+            p_bc->last_seq = payload[0];
+            p_bc->has_last = true;
+            p_bc->received++;
+            offset = RF24_BROADCAST_HEADER_SIZE;
+        }
+
+        if (len < size - offset) {
+            return RF24_BUFFER_TOO_SMALL;
+        }
+
+        memcpy(buff, &(payload[offset]), size - offset);
+        (*p_size) = size - offset;
+
+        return RF24_SUCCESS;
+    }
+
+    return dev_status;
+}
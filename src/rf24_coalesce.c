@@ -0,0 +1,133 @@
+/**
+ * @file rf24_coalesce.c
+ *
+ * @brief nRF24L01 small message coalescing, packing several messages per payload.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_coalesce.h"
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_coalesce_init(rf24_coalesce_t* p_co, rf24_dev_t* p_dev, uint32_t latency_us, bool enable_auto_ack) {
+    memset(p_co, 0, sizeof(rf24_coalesce_t));
+
+    p_co->p_dev = p_dev;
+    p_co->latency_us = latency_us;
+    p_co->enable_auto_ack = enable_auto_ack;
+}
+
+rf24_status_t rf24_coalesce_write(rf24_coalesce_t* p_co, uint8_t* buff, uint8_t len) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t capacity = rf24_get_payload_capacity(p_co->p_dev);
+
+    if ((len == 0) || (RF24_COALESCE_RECORD_HEADER_SIZE + len > capacity)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    if (p_co->tx_used + RF24_COALESCE_RECORD_HEADER_SIZE + len > capacity) {
+        dev_status = rf24_coalesce_flush(p_co);
+
+        if (dev_status != RF24_SUCCESS) {
+            return dev_status;
+        }
+    }
+
+    if (p_co->tx_used == 0) {
+        p_co->tx_first_us = rf24_get_time_us();
+    }
+
+    p_co->tx_buff[p_co->tx_used] = len;
+    memcpy(&(p_co->tx_buff[p_co->tx_used + RF24_COALESCE_RECORD_HEADER_SIZE]), buff, len);
+    p_co->tx_used += RF24_COALESCE_RECORD_HEADER_SIZE + len;
+    p_co->stats.messages_sent++;
+
+    // Not even a one byte message fits anymore
+    if (p_co->tx_used + RF24_COALESCE_RECORD_HEADER_SIZE + 1 > capacity) {
+        dev_status = rf24_coalesce_flush(p_co);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_coalesce_update(rf24_coalesce_t* p_co) {
+    if ((p_co->tx_used == 0) || ((rf24_get_time_us() - p_co->tx_first_us) < p_co->latency_us)) {
+        return RF24_SUCCESS;
+    }
+
+    return rf24_coalesce_flush(p_co);
+}
+
+rf24_status_t rf24_coalesce_flush(rf24_coalesce_t* p_co) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t size = rf24_get_payload_capacity(p_co->p_dev);
+
+    if (p_co->tx_used == 0) {
+        return RF24_SUCCESS;
+    }
+
+    // Dynamic payloads only carry the messages, static ones are padded with the end mark
+    if (p_co->p_dev->reg_image.feature.en_dpl) {
+        size = p_co->tx_used;
+    } else {
+        memset(&(p_co->tx_buff[p_co->tx_used]), 0, size - p_co->tx_used);
+    }
+
+    dev_status = rf24_write(p_co->p_dev, p_co->tx_buff, size, p_co->enable_auto_ack);
+
+    // The messages are dropped on failure too, like a single rf24_write would
+    p_co->tx_used = 0;
+
+    if (dev_status == RF24_SUCCESS) {
+        p_co->stats.frames_sent++;
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_coalesce_read(rf24_coalesce_t* p_co, uint8_t* buff, uint8_t len, uint8_t* p_pipe,
+                                 uint8_t* p_size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    while (true) {
+        if ((p_co->rx_offset < p_co->rx_size) && (p_co->rx_buff[p_co->rx_offset] != 0)) {
+            uint8_t msg_len = p_co->rx_buff[p_co->rx_offset];
+            uint8_t msg_offset = p_co->rx_offset + RF24_COALESCE_RECORD_HEADER_SIZE;
+
+            if (msg_offset + msg_len > p_co->rx_size) {
+                p_co->stats.malformed++;
+                p_co->rx_size = 0;
+                continue;
+            }
+
+            if (len < msg_len) {
+                return RF24_BUFFER_TOO_SMALL;
+            }
+
+            memcpy(buff, &(p_co->rx_buff[msg_offset]), msg_len);
+            (*p_size) = msg_len;
+            (*p_pipe) = p_co->rx_pipe;
+
+            p_co->rx_offset = msg_offset + msg_len;
+            p_co->stats.messages_received++;
+
+            return RF24_SUCCESS;
+        }
+
+        dev_status = rf24_read_next(p_co->p_dev, p_co->rx_buff, sizeof(p_co->rx_buff), &(p_co->rx_pipe),
+                                    &(p_co->rx_size));
+
+        if (dev_status != RF24_SUCCESS) {
+            p_co->rx_size = 0;
+            return dev_status;
+        }
+
+        p_co->rx_offset = 0;
+        p_co->stats.frames_received++;
+    }
+}
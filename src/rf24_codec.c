@@ -0,0 +1,291 @@
+/**
+ * @file rf24_codec.c
+ *
+ * @brief nRF24L01 telemetry codec, with delta and zig-zag varint encoding.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_codec.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define HEADER_KEYFRAME_MASK 0x80
+#define HEADER_ID_MASK       0x3F
+
+#define VARINT_DATA_MASK     0x7F
+#define VARINT_CONTINUE_MASK 0x80
+#define VARINT_DATA_BITS     7
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Maps a signed value to an unsigned one, small magnitudes to small values.
+ *
+ * @param value Signed value.
+ *
+ * @return Zig-zag encoded value.
+ */
+static uint32_t rf24_codec_zigzag_encode(int32_t value);
+
+/**
+ * @brief Maps a zig-zag encoded value back to the signed one.
+ *
+ * @param value Zig-zag encoded value.
+ *
+ * @return Signed value.
+ */
+static int32_t rf24_codec_zigzag_decode(uint32_t value);
+
+/**
+ * @brief Writes a value as a varint, 7 bits per byte from the least significant.
+ *
+ * @param value Value to be written.
+ * @param buff  Pointer to a buffer with at least @ref RF24_CODEC_MAX_VARINT_SIZE bytes.
+ *
+ * @return Number of bytes written.
+ */
+static uint8_t rf24_codec_varint_write(uint32_t value, uint8_t* buff);
+
+/**
+ * @brief Reads a varint.
+ *
+ * @param buff    Pointer to the varint.
+ * @param len     Bytes available.
+ * @param p_value Pointer to store the value.
+ *
+ * @return Number of bytes read, 0 when malformed.
+ */
+static uint8_t rf24_codec_varint_read(const uint8_t* buff, uint8_t len, uint32_t* p_value);
+
+/**
+ * @brief Finds a frame kept by the decoder.
+ *
+ * @param p_dec Pointer to decoder.
+ * @param id    Frame id.
+ *
+ * @return Pointer to the frame samples, NULL when no longer kept.
+ */
+static const int32_t* rf24_codec_find_reference(rf24_codec_decoder_t* p_dec, uint8_t id);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+rf24_status_t rf24_codec_encoder_init(rf24_codec_encoder_t* p_enc, uint8_t num_of_samples, uint8_t keyframe_interval) {
+    if ((num_of_samples == 0) || (num_of_samples > RF24_CODEC_MAX_SAMPLES)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    memset(p_enc, 0, sizeof(rf24_codec_encoder_t));
+
+    p_enc->num_of_samples = num_of_samples;
+    p_enc->keyframe_interval = keyframe_interval;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_codec_encode(rf24_codec_encoder_t* p_enc, const int32_t* samples, uint8_t* buff, uint8_t len,
+                                uint8_t* p_size) {
+    uint8_t frame[RF24_CODEC_HEADER_SIZE + RF24_CODEC_MAX_SAMPLES * RF24_CODEC_MAX_VARINT_SIZE];
+    uint8_t id = p_enc->next_id;
+    uint8_t size = RF24_CODEC_HEADER_SIZE;
+
+    // The decoder keeps the last frames only, the older references are lost
+    uint8_t distance = (id - p_enc->reference_id) & HEADER_ID_MASK;
+    bool keyframe = !p_enc->has_reference || (distance > RF24_CODEC_HISTORY_SIZE) ||
+                    ((p_enc->keyframe_interval != 0) && (p_enc->frames_since_keyframe >= p_enc->keyframe_interval));
+
+    frame[0] = (keyframe ? HEADER_KEYFRAME_MASK : 0) | id;
+    frame[1] = p_enc->num_of_samples;
+    frame[2] = p_enc->reference_id;
+
+    for (uint8_t i = 0; i < p_enc->num_of_samples; i++) {
+        // Wraps around on overflow, the decoder wraps back the same way
+        int32_t value = keyframe ? samples[i] : (int32_t) ((uint32_t) samples[i] - (uint32_t) p_enc->reference[i]);
+
+        size += rf24_codec_varint_write(rf24_codec_zigzag_encode(value), &(frame[size]));
+    }
+
+    if (size > len) {
+        return RF24_BUFFER_TOO_SMALL;
+    }
+
+    memcpy(buff, frame, size);
+    memcpy(p_enc->last, samples, p_enc->num_of_samples * sizeof(int32_t));
+    (*p_size) = size;
+
+    p_enc->next_id = (id + 1) & HEADER_ID_MASK;
+
+    if (keyframe) {
+        p_enc->frames_since_keyframe = 1;
+        p_enc->keyframes++;
+    } else {
+        p_enc->frames_since_keyframe++;
+        p_enc->deltas++;
+    }
+
+    return RF24_SUCCESS;
+}
+
+void rf24_codec_ack(rf24_codec_encoder_t* p_enc, bool delivered) {
+    if (!delivered) {
+        // Dropped before the frame ids wrap around onto it
+        if (((p_enc->next_id - p_enc->reference_id) & HEADER_ID_MASK) > RF24_CODEC_HISTORY_SIZE) {
+            p_enc->has_reference = false;
+        }
+
+        return;
+    }
+
+    memcpy(p_enc->reference, p_enc->last, p_enc->num_of_samples * sizeof(int32_t));
+    p_enc->reference_id = (p_enc->next_id - 1) & HEADER_ID_MASK;
+    p_enc->has_reference = true;
+}
+
+rf24_status_t rf24_codec_write(rf24_codec_encoder_t* p_enc, rf24_dev_t* p_dev, const int32_t* samples) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t capacity = rf24_get_payload_capacity(p_dev);
+    uint8_t size = 0;
+
+    dev_status = rf24_codec_encode(p_enc, samples, payload, capacity, &size);
+
+    if (dev_status != RF24_SUCCESS) {
+        return dev_status;
+    }
+
+    // Static payloads are padded, the decoder stops after the samples
+    if (!p_dev->reg_image.feature.en_dpl) {
+        memset(&(payload[size]), 0, capacity - size);
+        size = capacity;
+    }
+
+    dev_status = rf24_write(p_dev, payload, size, true);
+
+    rf24_codec_ack(p_enc, dev_status == RF24_SUCCESS);
+
+    return dev_status;
+}
+
+rf24_status_t rf24_codec_decoder_init(rf24_codec_decoder_t* p_dec, uint8_t num_of_samples) {
+    if ((num_of_samples == 0) || (num_of_samples > RF24_CODEC_MAX_SAMPLES)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    memset(p_dec, 0, sizeof(rf24_codec_decoder_t));
+
+    p_dec->num_of_samples = num_of_samples;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_codec_decode(rf24_codec_decoder_t* p_dec, const uint8_t* buff, uint8_t size, int32_t* samples) {
+    int32_t decoded[RF24_CODEC_MAX_SAMPLES];
+    const int32_t* reference = NULL;
+    uint8_t offset = RF24_CODEC_HEADER_SIZE;
+
+    if ((size < RF24_CODEC_HEADER_SIZE) || (buff[1] != p_dec->num_of_samples)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    bool keyframe = (buff[0] & HEADER_KEYFRAME_MASK) != 0;
+
+    if (!keyframe) {
+        reference = rf24_codec_find_reference(p_dec, buff[2] & HEADER_ID_MASK);
+
+        if (reference == NULL) {
+            p_dec->out_of_sync++;
+            return RF24_OUT_OF_SYNC;
+        }
+    }
+
+    // The reference may be the oldest slot, overwritten only once the frame is decoded
+    for (uint8_t i = 0; i < p_dec->num_of_samples; i++) {
+        uint32_t value = 0;
+        uint8_t read = rf24_codec_varint_read(&(buff[offset]), size - offset, &value);
+
+        if (read == 0) {
+            return RF24_INVALID_PARAMETERS;
+        }
+
+        offset += read;
+        decoded[i] = rf24_codec_zigzag_decode(value);
+
+        if (!keyframe) {
+            decoded[i] = (int32_t) ((uint32_t) reference[i] + (uint32_t) decoded[i]);
+        }
+    }
+
+    memcpy(samples, decoded, p_dec->num_of_samples * sizeof(int32_t));
+    memcpy(p_dec->history[p_dec->history_head], decoded, p_dec->num_of_samples * sizeof(int32_t));
+
+    p_dec->history_ids[p_dec->history_head] = buff[0] & HEADER_ID_MASK;
+    p_dec->history_head = (p_dec->history_head + 1) % RF24_CODEC_HISTORY_SIZE;
+
+    if (p_dec->history_count < RF24_CODEC_HISTORY_SIZE) {
+        p_dec->history_count++;
+    }
+
+    p_dec->decoded++;
+
+    return RF24_SUCCESS;
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static uint32_t rf24_codec_zigzag_encode(int32_t value) {
+    return ((uint32_t) value << 1) ^ (uint32_t) (-(int32_t) ((uint32_t) value >> 31));
+}
+
+static int32_t rf24_codec_zigzag_decode(uint32_t value) {
+    return (int32_t) ((value >> 1) ^ (uint32_t) (-(int32_t) (value & 1)));
+}
+
+static uint8_t rf24_codec_varint_write(uint32_t value, uint8_t* buff) {
+    uint8_t size = 0;
+
+    while (value > VARINT_DATA_MASK) {
+        buff[size++] = (value & VARINT_DATA_MASK) | VARINT_CONTINUE_MASK;
+        value >>= VARINT_DATA_BITS;
+    }
+
+    buff[size++] = value;
+
+    return size;
+}
+
+static uint8_t rf24_codec_varint_read(const uint8_t* buff, uint8_t len, uint32_t* p_value) {
+    uint32_t value = 0;
+
+    for (uint8_t i = 0; (i < len) && (i < RF24_CODEC_MAX_VARINT_SIZE); i++) {
+        value |= (uint32_t) (buff[i] & VARINT_DATA_MASK) << (i * VARINT_DATA_BITS);
+
+        if ((buff[i] & VARINT_CONTINUE_MASK) == 0) {
+            (*p_value) = value;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+static const int32_t* rf24_codec_find_reference(rf24_codec_decoder_t* p_dec, uint8_t id) {
+    for (uint8_t i = 0; i < p_dec->history_count; i++) {
+        uint8_t slot = (p_dec->history_head + RF24_CODEC_HISTORY_SIZE - 1 - i) % RF24_CODEC_HISTORY_SIZE;
+
+        if (p_dec->history_ids[slot] == id) {
+            return p_dec->history[slot];
+        }
+    }
+
+    return NULL;
+}
@@ -13,6 +13,8 @@
 #include <stdio.h>
 
 #include "rf24_debug.h"
+#include "rf24_histogram.h"
+#include "rf24_aead.h"
 
 /*****************************************
  * Private Constants
@@ -30,6 +32,16 @@
 #define PRINTF(...)
 #endif
 
+/*****************************************
+ * Private Variables
+ *****************************************/
+
+#ifdef DEBUG
+static const char* const m_histogram_names[RF24_NUM_OF_HISTOGRAMS] = {
+    "WRITE", "RX_LATENCY", "START_LISTENING", "STOP_LISTENING", "SPI",
+};
+#endif
+
 /*****************************************
  * Private Functions Prototypes
  *****************************************/
@@ -284,6 +296,72 @@ void rf24_debug_print_status(rf24_dev_t* p_dev) {
     );
 }
 
+void rf24_debug_print_histogram(uint8_t op) {
+    if (op >= RF24_NUM_OF_HISTOGRAMS) {
+        return;
+    }
+
+    rf24_histogram_t hist;
+    rf24_histogram_snapshot(op, &hist);
+
+    PRINTF(
+       "%-15s n=%lu min=%lu mean=%lu p50=%lu p90=%lu p99=%lu max=%lu (us)\r\n",
+       m_histogram_names[op], (unsigned long) hist.count, (unsigned long) hist.min_us,
+       (unsigned long) ((hist.count > 0) ? (hist.sum_us / hist.count) : 0),
+       (unsigned long) rf24_histogram_percentile(&hist, 50), (unsigned long) rf24_histogram_percentile(&hist, 90),
+       (unsigned long) rf24_histogram_percentile(&hist, 99), (unsigned long) hist.max_us
+    );
+
+    for (uint16_t i = 0; i < RF24_HISTOGRAM_NUM_OF_BUCKETS; i++) {
+        if (hist.counts[i] > 0) {
+            PRINTF("  >= %7lu us: %lu\r\n", (unsigned long) rf24_histogram_bucket_min_us(i),
+                   (unsigned long) hist.counts[i]);
+        }
+    }
+}
+
+void rf24_debug_print_aead_benchmark(uint16_t iterations) {
+#ifdef DEBUG
+    static const uint8_t key[RF24_AEAD_KEY_SIZE] = {0};
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE - RF24_AEAD_OVERHEAD] = {0};
+    uint8_t frame[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t size = 0;
+    uint8_t len = 0;
+    rf24_aead_t aead;
+
+    if (iterations == 0) {
+        return;
+    }
+
+    rf24_aead_init(&aead, NULL, key, 0, 0);
+    rf24_aead_set_peer(&aead, 0, 0);
+
+    uint32_t start_us = rf24_get_time_us();
+
+    for (uint16_t i = 0; i < iterations; i++) {
+        rf24_aead_seal(&aead, payload, sizeof(payload), frame, &size);
+    }
+
+    uint32_t seal_us = rf24_get_time_us() - start_us;
+    start_us = rf24_get_time_us();
+
+    // Every frame opened needs a new counter, so the seal time is taken out
+    for (uint16_t i = 0; i < iterations; i++) {
+        rf24_aead_seal(&aead, payload, sizeof(payload), frame, &size);
+        rf24_aead_open(&aead, 0, frame, size, payload, &len);
+    }
+
+    uint32_t open_us = rf24_get_time_us() - start_us - seal_us;
+
+    PRINTF(
+       "AEAD %u bytes payload: seal=%lu ns open=%lu ns per packet\r\n", (unsigned int) sizeof(payload),
+       (unsigned long) ((1000ULL * seal_us) / iterations), (unsigned long) ((1000ULL * open_us) / iterations)
+    );
+#else
+    (void) iterations;
+#endif
+}
+
 /*****************************************
  * Private Functions Bodies Definitions
  *****************************************/
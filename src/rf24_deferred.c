@@ -0,0 +1,78 @@
+/**
+ * @file rf24_deferred.c
+ *
+ * @brief nRF24L01 deferred interruption handling, with a lock free queue between the ISR and a worker.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_deferred.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define QUEUE_MASK (RF24_DEFERRED_QUEUE_SIZE - 1U)
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_deferred_init(rf24_deferred_t* p_def, rf24_dev_t* p_dev) {
+    memset(p_def->edges_us, 0, sizeof(p_def->edges_us));
+
+    p_def->p_dev = p_dev;
+    atomic_init(&(p_def->head), 0);
+    atomic_init(&(p_def->tail), 0);
+    p_def->overflows = 0;
+    p_def->edge_us = 0;
+}
+
+void rf24_deferred_isr(rf24_deferred_t* p_def) {
+    uint32_t now_us = rf24_get_time_us();
+    uint32_t head = atomic_load_explicit(&(p_def->head), memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&(p_def->tail), memory_order_acquire);
+
+    if ((head - tail) >= RF24_DEFERRED_QUEUE_SIZE) {
+        p_def->overflows++;
+        return;
+    }
+
+    p_def->edges_us[head & QUEUE_MASK] = now_us;
+
+    // Publishes the edge time before the new head
+    atomic_store_explicit(&(p_def->head), head + 1, memory_order_release);
+}
+
+bool rf24_deferred_process(rf24_deferred_t* p_def, rf24_irq_t* p_irq) {
+    uint32_t tail = atomic_load_explicit(&(p_def->tail), memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&(p_def->head), memory_order_acquire);
+
+    if (head == tail) {
+        return false;
+    }
+
+    p_def->edge_us = p_def->edges_us[tail & QUEUE_MASK];
+
+    // Frees the slot before the SPI work, so the ISR can queue the next edge meanwhile
+    atomic_store_explicit(&(p_def->tail), tail + 1, memory_order_release);
+
+    rf24_set_irq_edge_time(p_def->p_dev, p_def->edge_us);
+
+    rf24_irq_t irq_values = rf24_irq_callback(p_def->p_dev);
+
+    if (p_irq != NULL) {
+        (*p_irq) = irq_values;
+    }
+
+    return true;
+}
+
+uint32_t rf24_deferred_pending(rf24_deferred_t* p_def) {
+    uint32_t head = atomic_load_explicit(&(p_def->head), memory_order_acquire);
+    uint32_t tail = atomic_load_explicit(&(p_def->tail), memory_order_acquire);
+
+    return head - tail;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file rf24_failsafe.c
+ *
+ * @brief nRF24L01 link loss detector, with per pipe deadlines.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_failsafe.h"
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Calls the callback when one is set.
+ *
+ * @param p_fs   Pointer to failsafe.
+ * @param source Pipe number or @ref RF24_FAILSAFE_TX.
+ * @param lost   Whether the link was lost or recovered.
+ */
+static void rf24_failsafe_notify(rf24_failsafe_t* p_fs, uint8_t source, bool lost);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_failsafe_init(rf24_failsafe_t* p_fs, rf24_dev_t* p_dev, rf24_failsafe_callback_t callback, void* p_context) {
+    memset(p_fs, 0, sizeof(rf24_failsafe_t));
+
+    p_fs->p_dev = p_dev;
+    p_fs->callback = callback;
+    p_fs->p_context = p_context;
+}
+
+rf24_status_t rf24_failsafe_watch_pipe(rf24_failsafe_t* p_fs, uint8_t pipe_number, uint32_t deadline_us) {
+    if (pipe_number >= RF24_NUM_OF_PIPES) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    p_fs->deadline_us[pipe_number] = deadline_us;
+    p_fs->last_rx_us[pipe_number] = rf24_get_time_us();
+    p_fs->rx_count[pipe_number] = p_fs->p_dev->link.rx_count[pipe_number];
+    p_fs->lost_pipes &= ~_BV(pipe_number);
+
+    return RF24_SUCCESS;
+}
+
+void rf24_failsafe_watch_tx(rf24_failsafe_t* p_fs, uint8_t max_rt_limit) {
+    p_fs->max_rt_limit = max_rt_limit;
+    p_fs->tx_lost = false;
+}
+
+uint32_t rf24_failsafe_check(rf24_failsafe_t* p_fs) {
+    rf24_link_t* p_link = &(p_fs->p_dev->link);
+    uint32_t next_us = RF24_FAILSAFE_NO_DEADLINE;
+
+    for (uint8_t pipe = 0; pipe < RF24_NUM_OF_PIPES; pipe++) {
+        if (p_fs->deadline_us[pipe] == 0) {
+            continue;
+        }
+
+        bool lost = (p_fs->lost_pipes & _BV(pipe)) != 0;
+
+        if (p_link->rx_count[pipe] != p_fs->rx_count[pipe]) {
+            p_fs->rx_count[pipe] = p_link->rx_count[pipe];
+            p_fs->last_rx_us[pipe] = p_link->last_rx_us[pipe];
+
+            if (lost) {
+                p_fs->lost_pipes &= ~_BV(pipe);
+                lost = false;
+                rf24_failsafe_notify(p_fs, pipe, false);
+            }
+        }
+
+        if (lost) {
+            continue;
+        }
+
+        // Taken after the sync, a payload received meanwhile is never stamped later than now
+        uint32_t elapsed_us = rf24_get_time_us() - p_fs->last_rx_us[pipe];
+
+        if (elapsed_us >= p_fs->deadline_us[pipe]) {
+            p_fs->lost_pipes |= _BV(pipe);
+            rf24_failsafe_notify(p_fs, pipe, true);
+        } else if (p_fs->deadline_us[pipe] - elapsed_us < next_us) {
+            next_us = p_fs->deadline_us[pipe] - elapsed_us;
+        }
+    }
+
+    if (p_fs->max_rt_limit > 0) {
+        bool tx_lost = p_link->consecutive_max_rt >= p_fs->max_rt_limit;
+
+        if (tx_lost != p_fs->tx_lost) {
+            p_fs->tx_lost = tx_lost;
+            rf24_failsafe_notify(p_fs, RF24_FAILSAFE_TX, tx_lost);
+        }
+    }
+
+    return next_us;
+}
+
+rf24_irq_t rf24_failsafe_irq_callback(rf24_failsafe_t* p_fs) {
+    rf24_irq_t irq_values = rf24_irq_callback(p_fs->p_dev);
+
+    rf24_failsafe_check(p_fs);
+
+    return irq_values;
+}
+
+bool rf24_failsafe_is_lost(rf24_failsafe_t* p_fs) {
+    return (p_fs->lost_pipes != 0) || p_fs->tx_lost;
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static void rf24_failsafe_notify(rf24_failsafe_t* p_fs, uint8_t source, bool lost) {
+    if (p_fs->callback != NULL) {
+        p_fs->callback(p_fs->p_context, source, lost);
+    }
+}
@@ -0,0 +1,186 @@
+/**
+ * @file rf24_group.c
+ *
+ * @brief nRF24L01 group addressing, for more nodes than receiver pipes.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_group.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define GROUP_PIPE 1
+#define FIRST_DEDICATED_PIPE 2
+#define NUM_OF_DEDICATED_PIPES 4
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Programs the next turn of dedicated nodes on pipes 2 to 5.
+ *
+ * @param p_group Pointer to group.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_group_program_turn(rf24_group_t* p_group);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_group_init(rf24_group_t* p_group, rf24_dev_t* p_dev, uint8_t node_id, uint8_t* group_address) {
+    memset(p_group, 0, sizeof(rf24_group_t));
+
+    p_group->p_dev = p_dev;
+    p_group->node_id = node_id;
+    memcpy(p_group->group_address, group_address, p_dev->addr_width);
+
+    p_group->turn_us = rf24_worst_case_airtime_us(p_dev, p_dev->payload_size);
+}
+
+rf24_status_t rf24_group_open_receiver(rf24_group_t* p_group, bool enable_auto_ack) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    dev_status = rf24_open_reading_pipe(p_group->p_dev, GROUP_PIPE, p_group->group_address);
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_set_auto_ack(p_group->p_dev, GROUP_PIPE, enable_auto_ack);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_group_open_transmitter(rf24_group_t* p_group, uint8_t address_lsb) {
+    uint8_t address[RF24_ADDRESS_MAX_SIZE];
+
+    memcpy(address, p_group->group_address, RF24_ADDRESS_MAX_SIZE);
+    address[0] = address_lsb;
+
+    return rf24_open_writing_pipe(p_group->p_dev, address);
+}
+
+void rf24_group_accept(rf24_group_t* p_group, uint8_t node_id, bool accept) {
+    if (accept) {
+        p_group->filter[node_id / 8] |= _BV(node_id % 8);
+    } else {
+        p_group->filter[node_id / 8] &= ~_BV(node_id % 8);
+    }
+}
+
+rf24_status_t rf24_group_add_dedicated(rf24_group_t* p_group, uint8_t node_id, uint8_t address_lsb) {
+    if ((p_group->num_of_dedicated >= RF24_GROUP_MAX_DEDICATED_NODES) ||
+        (address_lsb == p_group->group_address[0])) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    p_group->dedicated[p_group->num_of_dedicated].node_id = node_id;
+    p_group->dedicated[p_group->num_of_dedicated].address_lsb = address_lsb;
+    p_group->num_of_dedicated++;
+
+    rf24_group_accept(p_group, node_id, true);
+
+    // With few enough nodes there are no turns, they all stay on the pipes
+    if (p_group->num_of_dedicated <= NUM_OF_DEDICATED_PIPES) {
+        p_group->next_dedicated = 0;
+        return rf24_group_program_turn(p_group);
+    }
+
+    return RF24_SUCCESS;
+}
+
+void rf24_group_set_turn_time(rf24_group_t* p_group, uint32_t turn_us) {
+    p_group->turn_us = turn_us;
+}
+
+rf24_status_t rf24_group_update(rf24_group_t* p_group) {
+    if ((p_group->num_of_dedicated <= NUM_OF_DEDICATED_PIPES) ||
+        ((rf24_get_time_us() - p_group->turn_start_us) < p_group->turn_us)) {
+        return RF24_SUCCESS;
+    }
+
+    return rf24_group_program_turn(p_group);
+}
+
+rf24_status_t rf24_group_write(rf24_group_t* p_group, uint8_t* buff, uint8_t len, bool enable_auto_ack) {
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE] = {0};
+    uint8_t payload_size = rf24_get_payload_capacity(p_group->p_dev);
+
+    if (len + RF24_GROUP_HEADER_SIZE > payload_size) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    payload[0] = p_group->node_id;
+    memcpy(&(payload[RF24_GROUP_HEADER_SIZE]), buff, len);
+
+    return rf24_write(p_group->p_dev, payload, payload_size, enable_auto_ack);
+}
+
+rf24_status_t rf24_group_read(rf24_group_t* p_group, uint8_t* buff, uint8_t len, uint8_t* p_node_id, uint8_t* p_size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t pipe;
+    uint8_t size;
+
+    while (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_read_next(p_group->p_dev, payload, sizeof(payload), &pipe, &size);
+
+        if (dev_status != RF24_SUCCESS) {
+            break;
+        }
+
+        uint8_t node_id = payload[0];
+
+        if ((size < RF24_GROUP_HEADER_SIZE) || !(p_group->filter[node_id / 8] & _BV(node_id % 8))) {
+            p_group->filtered++;
+            continue;
+        }
+
+        size -= RF24_GROUP_HEADER_SIZE;
+
+        if (len < size) {
+            return RF24_BUFFER_TOO_SMALL;
+        }
+
+        memcpy(buff, &(payload[RF24_GROUP_HEADER_SIZE]), size);
+        (*p_node_id) = node_id;
+        (*p_size) = size;
+
+        return RF24_SUCCESS;
+    }
+
+    return dev_status;
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static rf24_status_t rf24_group_program_turn(rf24_group_t* p_group) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    for (uint8_t i = 0; (i < NUM_OF_DEDICATED_PIPES) && (dev_status == RF24_SUCCESS); i++) {
+        uint8_t pipe = FIRST_DEDICATED_PIPE + i;
+
+        if (i < p_group->num_of_dedicated) {
+            uint8_t index = (p_group->next_dedicated + i) % p_group->num_of_dedicated;
+            dev_status = rf24_open_reading_pipe(p_group->p_dev, pipe, &(p_group->dedicated[index].address_lsb));
+        } else {
+            dev_status = rf24_close_reading_pipe(p_group->p_dev, pipe);
+        }
+    }
+
+    if (p_group->num_of_dedicated > NUM_OF_DEDICATED_PIPES) {
+        p_group->next_dedicated = (p_group->next_dedicated + NUM_OF_DEDICATED_PIPES) % p_group->num_of_dedicated;
+    }
+
+    p_group->turn_start_us = rf24_get_time_us();
+
+    return dev_status;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file rf24_histogram.c
+ *
+ * @brief nRF24L01 operation latency histograms, with fixed memory log-linear buckets.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_histogram.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define OVERFLOW_BUCKET (RF24_HISTOGRAM_NUM_OF_BUCKETS - 1)
+
+/*****************************************
+ * Private Variables
+ *****************************************/
+
+static rf24_histogram_t m_histograms[RF24_NUM_OF_HISTOGRAMS];
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Gets the bucket of a value.
+ *
+ * @note Values under the number of sub-buckets have a bucket each, the
+ *       others are split in sub-buckets per power of 2.
+ *
+ * @param value_us Value in microseconds.
+ *
+ * @return Bucket index.
+ */
+static uint16_t rf24_histogram_bucket(uint32_t value_us);
+
+/**
+ * @brief Writes a 32 bits value as little endian.
+ *
+ * @param buff  Pointer to a buffer where the data should be written.
+ * @param value Value to be written.
+ */
+static void rf24_histogram_put_u32(uint8_t* buff, uint32_t value);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_histogram_record(rf24_histogram_op_t op, uint32_t value_us) {
+    if (op >= RF24_NUM_OF_HISTOGRAMS) {
+        return;
+    }
+
+    rf24_histogram_t* p_hist = &(m_histograms[op]);
+
+    if ((p_hist->count == 0) || (value_us < p_hist->min_us)) {
+        p_hist->min_us = value_us;
+    }
+
+    if (value_us > p_hist->max_us) {
+        p_hist->max_us = value_us;
+    }
+
+    p_hist->counts[rf24_histogram_bucket(value_us)]++;
+    p_hist->count++;
+    p_hist->sum_us += value_us;
+}
+
+void rf24_histogram_snapshot(rf24_histogram_op_t op, rf24_histogram_t* p_snapshot) {
+    if (op >= RF24_NUM_OF_HISTOGRAMS) {
+        memset(p_snapshot, 0, sizeof(rf24_histogram_t));
+        return;
+    }
+
+    memcpy(p_snapshot, &(m_histograms[op]), sizeof(rf24_histogram_t));
+}
+
+void rf24_histogram_reset(void) {
+    memset(m_histograms, 0, sizeof(m_histograms));
+}
+
+uint32_t rf24_histogram_percentile(const rf24_histogram_t* p_hist, uint8_t percent) {
+    if (p_hist->count == 0) {
+        return 0;
+    }
+
+    // Rounded up, so any percentage over 0 needs at least one record
+    uint64_t target = ((uint64_t) p_hist->count * percent + 99) / 100;
+    uint64_t accumulated = 0;
+
+    for (uint16_t i = 0; i < OVERFLOW_BUCKET; i++) {
+        accumulated += p_hist->counts[i];
+
+        if ((accumulated >= target) && (accumulated > 0)) {
+            uint32_t upper_us = rf24_histogram_bucket_min_us(i + 1) - 1;
+
+            return (upper_us < p_hist->max_us) ? (upper_us) : (p_hist->max_us);
+        }
+    }
+
+    return p_hist->max_us;
+}
+
+uint32_t rf24_histogram_bucket_min_us(uint16_t bucket) {
+    if (bucket < RF24_HISTOGRAM_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    if (bucket >= OVERFLOW_BUCKET) {
+        return 1UL << RF24_HISTOGRAM_MAX_BITS;
+    }
+
+    uint8_t shift = (uint8_t) (bucket / RF24_HISTOGRAM_SUB_BUCKETS - 1);
+
+    return (uint32_t) (RF24_HISTOGRAM_SUB_BUCKETS + bucket % RF24_HISTOGRAM_SUB_BUCKETS) << shift;
+}
+
+uint16_t rf24_histogram_export(const rf24_histogram_t* p_hist, uint8_t* buff, uint16_t len) {
+    uint16_t size = RF24_HISTOGRAM_EXPORT_HEADER_SIZE;
+
+    if (len < size) {
+        return 0;
+    }
+
+    buff[0] = RF24_HISTOGRAM_SUB_BITS;
+    buff[1] = RF24_HISTOGRAM_MAX_BITS;
+    rf24_histogram_put_u32(&(buff[2]), p_hist->count);
+    rf24_histogram_put_u32(&(buff[6]), p_hist->min_us);
+    rf24_histogram_put_u32(&(buff[10]), p_hist->max_us);
+
+    for (uint16_t i = 0; i < RF24_HISTOGRAM_NUM_OF_BUCKETS; i++) {
+        uint32_t count = p_hist->counts[i];
+
+        if (count == 0) {
+            continue;
+        }
+
+        if (size >= len) {
+            return 0;
+        }
+
+        buff[size++] = (uint8_t) i;
+
+        do {
+            if (size >= len) {
+                return 0;
+            }
+
+            buff[size++] = (uint8_t) ((count & 0x7FU) | ((count > 0x7FU) ? 0x80U : 0x00U));
+            count >>= 7;
+        } while (count > 0);
+    }
+
+    return size;
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static uint16_t rf24_histogram_bucket(uint32_t value_us) {
+    if (value_us < RF24_HISTOGRAM_SUB_BUCKETS) {
+        return (uint16_t) value_us;
+    }
+
+    uint8_t msb = (uint8_t) (31 - __builtin_clz(value_us));
+
+    if (msb >= RF24_HISTOGRAM_MAX_BITS) {
+        return OVERFLOW_BUCKET;
+    }
+
+    uint8_t shift = msb - RF24_HISTOGRAM_SUB_BITS;
+
+    return (uint16_t) ((shift + 1) * RF24_HISTOGRAM_SUB_BUCKETS +
+                       ((value_us >> shift) & (RF24_HISTOGRAM_SUB_BUCKETS - 1)));
+}
+
+static void rf24_histogram_put_u32(uint8_t* buff, uint32_t value) {
+    buff[0] = (uint8_t) value;
+    buff[1] = (uint8_t) (value >> 8);
+    buff[2] = (uint8_t) (value >> 16);
+    buff[3] = (uint8_t) (value >> 24);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file rf24_hub.c
+ *
+ * @brief nRF24L01 star network hub, with per pipe queues and fair servicing.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_hub.h"
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_hub_init(rf24_hub_t* p_hub, rf24_dev_t* p_dev) {
+    memset(p_hub, 0, sizeof(rf24_hub_t));
+
+    p_hub->p_dev = p_dev;
+
+    for (uint8_t i = 0; i < RF24_NUM_OF_PIPES; i++) {
+        p_hub->queues[i].weight = 1;
+    }
+
+    p_hub->credits = 1;
+}
+
+rf24_status_t rf24_hub_open_pipe(rf24_hub_t* p_hub, uint8_t pipe_number, uint8_t* address, uint8_t payload_size) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    dev_status = rf24_set_pipe_payload_size(p_hub->p_dev, pipe_number, payload_size);
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_open_reading_pipe(p_hub->p_dev, pipe_number, address);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_hub_set_weight(rf24_hub_t* p_hub, uint8_t pipe_number, uint8_t weight) {
+    if ((pipe_number >= RF24_NUM_OF_PIPES) || (weight == 0)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    p_hub->queues[pipe_number].weight = weight;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_hub_poll(rf24_hub_t* p_hub) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t buff[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t pipe;
+    uint8_t size;
+
+    while (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_read_next(p_hub->p_dev, buff, sizeof(buff), &pipe, &size);
+
+        if (dev_status == RF24_SUCCESS) {
+            rf24_hub_queue_t* p_queue = &(p_hub->queues[pipe]);
+
+            if (p_queue->count < RF24_HUB_QUEUE_SIZE) {
+                uint8_t tail = (p_queue->head + p_queue->count) % RF24_HUB_QUEUE_SIZE;
+
+                memcpy(p_queue->data[tail], buff, size);
+                p_queue->size[tail] = size;
+                p_queue->count++;
+                p_queue->received++;
+            } else {
+                p_queue->dropped++;
+            }
+        }
+    }
+
+    return (dev_status == RF24_RX_FIFO_EMPTY) ? (RF24_SUCCESS) : (dev_status);
+}
+
+rf24_status_t rf24_hub_read(rf24_hub_t* p_hub, uint8_t* buff, uint8_t len, uint8_t* p_pipe, uint8_t* p_size) {
+    // Visits every pipe once, plus the current one again if it still has credits left
+    for (uint8_t i = 0; i <= RF24_NUM_OF_PIPES; i++) {
+        rf24_hub_queue_t* p_queue = &(p_hub->queues[p_hub->current_pipe]);
+
+        if ((p_queue->count > 0) && (p_hub->credits > 0)) {
+            uint8_t size = p_queue->size[p_queue->head];
+
+            if (len < size) {
+                return RF24_BUFFER_TOO_SMALL;
+            }
+
+            memcpy(buff, p_queue->data[p_queue->head], size);
+            (*p_pipe) = p_hub->current_pipe;
+            (*p_size) = size;
+
+            p_queue->head = (p_queue->head + 1) % RF24_HUB_QUEUE_SIZE;
+            p_queue->count--;
+            p_hub->credits--;
+
+            return RF24_SUCCESS;
+        }
+
+        p_hub->current_pipe = (p_hub->current_pipe + 1) % RF24_NUM_OF_PIPES;
+        p_hub->credits = p_hub->queues[p_hub->current_pipe].weight;
+    }
+
+    return RF24_RX_FIFO_EMPTY;
+}
+
+rf24_status_t rf24_hub_reply(rf24_hub_t* p_hub, uint8_t pipe_number, uint8_t* buff, uint8_t len) {
+    return rf24_write_ack_payload(p_hub->p_dev, pipe_number, buff, len);
+}
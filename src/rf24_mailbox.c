@@ -0,0 +1,106 @@
+/**
+ * @file rf24_mailbox.c
+ *
+ * @brief nRF24L01 latest value receiver, keeping only the newest payload per pipe.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_mailbox.h"
+
+/*****************************************
+ * Private Macros
+ *****************************************/
+
+/**
+ * @brief Keeps the compiler from moving memory accesses across the sequence updates.
+ */
+#define COMPILER_BARRIER() __asm volatile ("" ::: "memory")
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_mailbox_init(rf24_mailbox_t* p_mb, rf24_dev_t* p_dev) {
+    memset(p_mb, 0, sizeof(rf24_mailbox_t));
+
+    p_mb->p_dev = p_dev;
+}
+
+rf24_status_t rf24_mailbox_update(rf24_mailbox_t* p_mb) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t pipe;
+    uint8_t size;
+
+    while (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_read_next(p_mb->p_dev, payload, sizeof(payload), &pipe, &size);
+
+        if ((dev_status != RF24_SUCCESS) || (pipe >= RF24_NUM_OF_PIPES)) {
+            break;
+        }
+
+        rf24_mailbox_slot_t* p_slot = &(p_mb->slots[pipe]);
+
+        if (p_slot->unread) {
+            p_mb->overwritten++;
+        }
+
+        p_slot->seq++;
+        COMPILER_BARRIER();
+
+        memcpy(p_slot->data, payload, size);
+        p_slot->size = size;
+        p_slot->timestamp_us = rf24_get_rx_timestamp_us(p_mb->p_dev);
+
+        COMPILER_BARRIER();
+        p_slot->seq++;
+        p_slot->unread = true;
+
+        p_mb->received++;
+    }
+
+    return (dev_status == RF24_RX_FIFO_EMPTY) ? (RF24_SUCCESS) : (dev_status);
+}
+
+rf24_status_t rf24_mailbox_read(rf24_mailbox_t* p_mb, uint8_t pipe_number, uint8_t* buff, uint8_t len,
+                                uint8_t* p_size, uint32_t* p_timestamp_us) {
+    if (pipe_number >= RF24_NUM_OF_PIPES) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    rf24_mailbox_slot_t* p_slot = &(p_mb->slots[pipe_number]);
+    uint32_t seq;
+    uint8_t size;
+    uint32_t timestamp_us;
+
+    do {
+        seq = p_slot->seq;
+        COMPILER_BARRIER();
+
+        if (seq == 0) {
+            return RF24_RX_FIFO_EMPTY;
+        }
+
+        size = p_slot->size;
+        timestamp_us = p_slot->timestamp_us;
+        memcpy(buff, p_slot->data, (len < size) ? len : size);
+
+        COMPILER_BARRIER();
+    } while (((seq & 1U) != 0) || (seq != p_slot->seq));
+
+    if (len < size) {
+        return RF24_BUFFER_TOO_SMALL;
+    }
+
+    p_slot->unread = false;
+    (*p_size) = size;
+
+    if (p_timestamp_us != NULL) {
+        (*p_timestamp_us) = timestamp_us;
+    }
+
+    return RF24_SUCCESS;
+}
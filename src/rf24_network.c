@@ -0,0 +1,454 @@
+/**
+ * @file rf24_network.c
+ *
+ * @brief nRF24L01 tree network layer, with multi hop routing.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_network.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define BITS_PER_LEVEL 3
+#define PARENT_PIPE 0
+
+/**
+ * @brief Frames loaded in the transmitter FIFO at once.
+ */
+#define TX_FIFO_SIZE 3
+
+#define HEADER_FROM_OFFSET 0
+#define HEADER_TO_OFFSET 2
+#define HEADER_ID_OFFSET 4
+#define HEADER_TYPE_OFFSET 5
+
+/**
+ * @brief Address LSB of each pipe, alternating bits for a clean preamble.
+ */
+static const uint8_t m_pipe_lsb[RF24_NUM_OF_PIPES] = {0x3C, 0x5A, 0x69, 0x96, 0xA5, 0xC3};
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Gets the number of levels of a node address.
+ *
+ * @param node_address Octal node address.
+ *
+ * @return Number of levels, 0 for the root.
+ */
+static uint8_t rf24_network_level(uint16_t node_address);
+
+/**
+ * @brief Checks if a node address is valid, with digits from 1 to 5.
+ *
+ * @param node_address Octal node address.
+ *
+ * @return Whether the address is valid or not.
+ */
+static bool rf24_network_is_valid(uint16_t node_address);
+
+/**
+ * @brief Builds the address of a node pipe.
+ *
+ * @param p_net        Pointer to network node.
+ * @param node_address Octal node address.
+ * @param pipe_number  Number of the pipe.
+ * @param address      Buffer to store the pipe address.
+ */
+static void rf24_network_pipe_address(rf24_network_t* p_net, uint16_t node_address, uint8_t pipe_number,
+                                      uint8_t* address);
+
+/**
+ * @brief Opens the pipe of a neighbor that listens to this node.
+ *
+ * @param p_net    Pointer to network node.
+ * @param next_hop Parent or child node address.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_network_open_next_hop(rf24_network_t* p_net, uint16_t next_hop);
+
+/**
+ * @brief Moves all frames in the receiver FIFO to the network queues.
+ *
+ * @param p_net Pointer to network node.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_network_receive(rf24_network_t* p_net);
+
+/**
+ * @brief Sends the frames waiting to be forwarded.
+ *
+ * @param p_net Pointer to network node.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_network_forward(rf24_network_t* p_net);
+
+/**
+ * @brief Checks if a frame was already received, recording it otherwise.
+ *
+ * @param p_net    Pointer to network node.
+ * @param p_header Pointer to the frame header.
+ *
+ * @return Whether the frame is a duplicate or not.
+ */
+static bool rf24_network_is_duplicate(rf24_network_t* p_net, rf24_network_header_t* p_header);
+
+static bool rf24_network_push(rf24_network_queue_t* p_queue, rf24_network_frame_t* p_frame);
+
+static void rf24_network_serialize(rf24_network_frame_t* p_frame, uint8_t* payload);
+
+static void rf24_network_deserialize(uint8_t* payload, uint8_t size, rf24_network_frame_t* p_frame);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+rf24_status_t rf24_network_init(rf24_network_t* p_net, rf24_dev_t* p_dev, uint16_t node_address, uint8_t* network_id) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t address[RF24_ADDRESS_MAX_SIZE];
+
+    if (!rf24_network_is_valid(node_address)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    memset(p_net, 0, sizeof(rf24_network_t));
+
+    p_net->p_dev = p_dev;
+    p_net->node_address = node_address;
+    p_net->network_id[0] = network_id[0];
+    p_net->network_id[1] = network_id[1];
+
+    for (uint8_t i = 0; (i < RF24_NUM_OF_PIPES) && (dev_status == RF24_SUCCESS); i++) {
+        rf24_network_pipe_address(p_net, node_address, i, address);
+        dev_status = rf24_open_reading_pipe(p_dev, i, address);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_start_listening(p_dev);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_network_add_route(rf24_network_t* p_net, uint16_t to, uint16_t next_hop) {
+    bool is_neighbor = (next_hop == rf24_network_parent(p_net->node_address)) ||
+                       (rf24_network_parent(next_hop) == p_net->node_address);
+
+    if ((p_net->num_of_routes >= RF24_NETWORK_MAX_ROUTES) || !rf24_network_is_valid(to) || !is_neighbor ||
+        (next_hop == p_net->node_address)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    p_net->routes[p_net->num_of_routes].to = to;
+    p_net->routes[p_net->num_of_routes].next_hop = next_hop;
+    p_net->num_of_routes++;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_network_update(rf24_network_t* p_net) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    dev_status = rf24_network_receive(p_net);
+
+    if ((dev_status == RF24_SUCCESS) && (p_net->forward_queue.count > 0)) {
+        dev_status = rf24_network_forward(p_net);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_network_write(rf24_network_t* p_net, uint16_t to, uint8_t type, uint8_t* buff, uint8_t len) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_network_frame_t frame;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE] = {0};
+
+    if ((len > RF24_NETWORK_MAX_PAYLOAD_SIZE) || !rf24_network_is_valid(to) ||
+        (RF24_NETWORK_HEADER_SIZE + len > rf24_get_payload_capacity(p_net->p_dev))) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    frame.header.from = p_net->node_address;
+    frame.header.to = to;
+    frame.header.id = p_net->next_id++;
+    frame.header.type = type;
+    frame.size = len;
+    memcpy(frame.data, buff, len);
+
+    if (to == p_net->node_address) {
+        return rf24_network_push(&(p_net->rx_queue), &frame) ? (RF24_SUCCESS) : (RF24_BUSY);
+    }
+
+    // Stopping to listen flushes the receiver FIFO, so it is emptied first
+    dev_status = rf24_network_receive(p_net);
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_stop_listening(p_net->p_dev);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_network_open_next_hop(p_net, rf24_network_next_hop(p_net, to));
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        rf24_network_serialize(&frame, payload);
+        dev_status = rf24_write(p_net->p_dev, payload, rf24_get_payload_capacity(p_net->p_dev), true);
+
+        if (dev_status == RF24_SUCCESS) {
+            p_net->stats.sent++;
+        } else {
+            p_net->stats.send_failures++;
+        }
+    }
+
+    rf24_status_t listen_status = rf24_start_listening(p_net->p_dev);
+
+    return (dev_status == RF24_SUCCESS) ? (listen_status) : (dev_status);
+}
+
+rf24_status_t rf24_network_read(rf24_network_t* p_net, rf24_network_frame_t* p_frame) {
+    rf24_network_queue_t* p_queue = &(p_net->rx_queue);
+
+    if (p_queue->count == 0) {
+        return RF24_RX_FIFO_EMPTY;
+    }
+
+    *p_frame = p_queue->frames[p_queue->head];
+    p_queue->head = (p_queue->head + 1) % RF24_NETWORK_QUEUE_SIZE;
+    p_queue->count--;
+
+    return RF24_SUCCESS;
+}
+
+uint16_t rf24_network_parent(uint16_t node_address) {
+    uint8_t level = rf24_network_level(node_address);
+
+    if (level == 0) {
+        return 0;
+    }
+
+    return node_address & ((1U << (BITS_PER_LEVEL * (level - 1))) - 1);
+}
+
+uint16_t rf24_network_next_hop(rf24_network_t* p_net, uint16_t to) {
+    uint8_t level = rf24_network_level(p_net->node_address);
+    uint16_t mask = (1U << (BITS_PER_LEVEL * level)) - 1;
+
+    for (uint8_t i = 0; i < p_net->num_of_routes; i++) {
+        if (p_net->routes[i].to == to) {
+            return p_net->routes[i].next_hop;
+        }
+    }
+
+    if (to == p_net->node_address) {
+        return to;
+    }
+
+    // Descendants are reached through the child on their branch, all other nodes through the parent
+    if ((rf24_network_level(to) > level) && ((to & mask) == p_net->node_address)) {
+        return to & ((1U << (BITS_PER_LEVEL * (level + 1))) - 1);
+    }
+
+    return rf24_network_parent(p_net->node_address);
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static uint8_t rf24_network_level(uint16_t node_address) {
+    uint8_t level = 0;
+
+    while (node_address > 0) {
+        node_address >>= BITS_PER_LEVEL;
+        level++;
+    }
+
+    return level;
+}
+
+static bool rf24_network_is_valid(uint16_t node_address) {
+    if (rf24_network_level(node_address) > RF24_NETWORK_MAX_LEVELS) {
+        return false;
+    }
+
+    while (node_address > 0) {
+        uint8_t digit = node_address & ((1U << BITS_PER_LEVEL) - 1);
+
+        if ((digit == 0) || (digit > RF24_NETWORK_MAX_CHILDREN)) {
+            return false;
+        }
+
+        node_address >>= BITS_PER_LEVEL;
+    }
+
+    return true;
+}
+
+static void rf24_network_pipe_address(rf24_network_t* p_net, uint16_t node_address, uint8_t pipe_number,
+                                      uint8_t* address) {
+    // Pipes 2 to 5 share all bytes but the LSB with pipe 1, so only the LSB depends on the pipe
+    address[0] = m_pipe_lsb[pipe_number];
+    address[1] = (uint8_t) (node_address & 0xFF);
+    address[2] = (uint8_t) (node_address >> 8);
+    address[3] = p_net->network_id[0];
+    address[4] = p_net->network_id[1];
+}
+
+static rf24_status_t rf24_network_open_next_hop(rf24_network_t* p_net, uint16_t next_hop) {
+    uint8_t address[RF24_ADDRESS_MAX_SIZE];
+    uint8_t pipe_number = PARENT_PIPE;
+
+    // The parent listens to each child on the pipe of the child last digit
+    if (next_hop == rf24_network_parent(p_net->node_address)) {
+        uint8_t level = rf24_network_level(p_net->node_address);
+        pipe_number = (p_net->node_address >> (BITS_PER_LEVEL * (level - 1))) & ((1U << BITS_PER_LEVEL) - 1);
+    }
+
+    rf24_network_pipe_address(p_net, next_hop, pipe_number, address);
+
+    return rf24_open_writing_pipe(p_net->p_dev, address);
+}
+
+static rf24_status_t rf24_network_receive(rf24_network_t* p_net) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_network_frame_t frame;
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE];
+    uint8_t pipe;
+    uint8_t size;
+
+    while (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_read_next(p_net->p_dev, payload, sizeof(payload), &pipe, &size);
+
+        if ((dev_status != RF24_SUCCESS) || (size < RF24_NETWORK_HEADER_SIZE)) {
+            continue;
+        }
+
+        rf24_network_deserialize(payload, size, &frame);
+
+        if (rf24_network_is_duplicate(p_net, &(frame.header))) {
+            p_net->stats.duplicates++;
+            continue;
+        }
+
+        // Frames come from the air unchecked, one with no next hop would be sent back to this node
+        if (!rf24_network_is_valid(frame.header.to) ||
+            ((frame.header.to != p_net->node_address) &&
+             (rf24_network_next_hop(p_net, frame.header.to) == p_net->node_address))) {
+            p_net->stats.unroutable++;
+            continue;
+        }
+
+        if (frame.header.to == p_net->node_address) {
+            if (rf24_network_push(&(p_net->rx_queue), &frame)) {
+                p_net->stats.delivered++;
+            } else {
+                p_net->stats.queue_drops++;
+            }
+        } else if (!rf24_network_push(&(p_net->forward_queue), &frame)) {
+            p_net->stats.queue_drops++;
+        }
+    }
+
+    return (dev_status == RF24_RX_FIFO_EMPTY) ? (RF24_SUCCESS) : (dev_status);
+}
+
+static rf24_status_t rf24_network_forward(rf24_network_t* p_net) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    rf24_network_queue_t* p_queue = &(p_net->forward_queue);
+    uint8_t payload[RF24_MAX_PAYLOAD_SIZE] = {0};
+
+    dev_status = rf24_stop_listening(p_net->p_dev);
+
+    while ((dev_status == RF24_SUCCESS) && (p_queue->count > 0)) {
+        uint16_t next_hop = rf24_network_next_hop(p_net, p_queue->frames[p_queue->head].header.to);
+        uint8_t loaded = 0;
+
+        dev_status = rf24_network_open_next_hop(p_net, next_hop);
+
+        // Frames to the same next hop are pipelined through the transmitter FIFO
+        while ((dev_status == RF24_SUCCESS) && (p_queue->count > 0) && (loaded < TX_FIFO_SIZE) &&
+               (rf24_network_next_hop(p_net, p_queue->frames[p_queue->head].header.to) == next_hop)) {
+            rf24_network_serialize(&(p_queue->frames[p_queue->head]), payload);
+            dev_status = rf24_write_fast(p_net->p_dev, payload, rf24_get_payload_capacity(p_net->p_dev), true);
+
+            p_queue->head = (p_queue->head + 1) % RF24_NETWORK_QUEUE_SIZE;
+            p_queue->count--;
+            loaded++;
+        }
+
+        if (dev_status == RF24_SUCCESS) {
+            dev_status = rf24_tx_standby(p_net->p_dev);
+        }
+
+        // The remaining frames of a failed batch are flushed
+        if (dev_status == RF24_SUCCESS) {
+            p_net->stats.forwarded += loaded;
+        } else {
+            p_net->stats.forward_failures += loaded;
+        }
+
+        dev_status = (dev_status == RF24_MAX_RETRANSMIT) ? (RF24_SUCCESS) : (dev_status);
+    }
+
+    rf24_status_t listen_status = rf24_start_listening(p_net->p_dev);
+
+    return (dev_status == RF24_SUCCESS) ? (listen_status) : (dev_status);
+}
+
+static bool rf24_network_is_duplicate(rf24_network_t* p_net, rf24_network_header_t* p_header) {
+    for (uint8_t i = 0; i < RF24_NETWORK_DUPLICATES_SIZE; i++) {
+        if ((p_net->duplicates[i].from == p_header->from) && (p_net->duplicates[i].id == p_header->id) &&
+            (p_net->duplicates[i].to == p_header->to) && (p_net->duplicates[i].type == p_header->type)) {
+            return true;
+        }
+    }
+
+    p_net->duplicates[p_net->duplicates_head] = *p_header;
+    p_net->duplicates_head = (p_net->duplicates_head + 1) % RF24_NETWORK_DUPLICATES_SIZE;
+
+    return false;
+}
+
+static bool rf24_network_push(rf24_network_queue_t* p_queue, rf24_network_frame_t* p_frame) {
+    if (p_queue->count >= RF24_NETWORK_QUEUE_SIZE) {
+        return false;
+    }
+
+    p_queue->frames[(p_queue->head + p_queue->count) % RF24_NETWORK_QUEUE_SIZE] = *p_frame;
+    p_queue->count++;
+
+    return true;
+}
+
+static void rf24_network_serialize(rf24_network_frame_t* p_frame, uint8_t* payload) {
+    payload[HEADER_FROM_OFFSET] = (uint8_t) (p_frame->header.from & 0xFF);
+    payload[HEADER_FROM_OFFSET + 1] = (uint8_t) (p_frame->header.from >> 8);
+    payload[HEADER_TO_OFFSET] = (uint8_t) (p_frame->header.to & 0xFF);
+    payload[HEADER_TO_OFFSET + 1] = (uint8_t) (p_frame->header.to >> 8);
+    payload[HEADER_ID_OFFSET] = p_frame->header.id;
+    payload[HEADER_TYPE_OFFSET] = p_frame->header.type;
+
+    memcpy(&(payload[RF24_NETWORK_HEADER_SIZE]), p_frame->data, p_frame->size);
+}
+
+static void rf24_network_deserialize(uint8_t* payload, uint8_t size, rf24_network_frame_t* p_frame) {
+    p_frame->header.from = (uint16_t) (payload[HEADER_FROM_OFFSET] | (payload[HEADER_FROM_OFFSET + 1] << 8));
+    p_frame->header.to = (uint16_t) (payload[HEADER_TO_OFFSET] | (payload[HEADER_TO_OFFSET + 1] << 8));
+    p_frame->header.id = payload[HEADER_ID_OFFSET];
+    p_frame->header.type = payload[HEADER_TYPE_OFFSET];
+
+    // Static payloads carry no length, so the data takes the whole payload after the header
+    p_frame->size = size - RF24_NETWORK_HEADER_SIZE;
+    memcpy(p_frame->data, &(payload[RF24_NETWORK_HEADER_SIZE]), p_frame->size);
+}
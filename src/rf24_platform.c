@@ -10,6 +10,16 @@
  */
 
 #include "rf24_platform.h"
+#include "rf24_histogram.h"
+
+/*****************************************
+ * Private Variables
+ *****************************************/
+
+#ifdef RF24_HISTOGRAM
+static uint32_t m_transaction_start_us;
+static bool m_transaction_active = false;
+#endif
 
 /*****************************************
  * Private Functions Prototypes
@@ -61,6 +71,10 @@ rf24_platform_status_t rf24_platform_disable(rf24_platform_t* p_setup) {
     return status;
 }
 
+bool rf24_platform_irq_asserted(rf24_platform_t* p_setup) {
+    return HAL_GPIO_ReadPin(p_setup->irq_port, p_setup->irq_pin) == GPIO_PIN_RESET;
+}
+
 rf24_platform_status_t rf24_platform_send_command(rf24_platform_t* p_setup, nrf24l01_spi_commands_t command) {
     rf24_platform_status_t status;
     HAL_StatusTypeDef hal_status;
@@ -189,6 +203,47 @@ rf24_platform_status_t rf24_platform_write_payload(rf24_platform_t* p_setup, uin
     return status;
 }
 
+rf24_platform_status_t rf24_platform_write_ack_payload(rf24_platform_t* p_setup, uint8_t pipe_number, uint8_t* buff,
+                                                       uint8_t len) {
+    rf24_platform_status_t status;
+    HAL_StatusTypeDef hal_status;
+    nrf24l01_reg_status_t status_reg;
+
+    rf24_begin_transaction(p_setup);
+
+    uint8_t command = NRF24L01_COMM_W_ACK_PAYLOAD | (NRF24L01_COMM_W_ACK_PAYLOAD_MASK & pipe_number);
+    hal_status = HAL_SPI_TransmitReceive(p_setup->hspi, &command, &(status_reg.value), 1, p_setup->spi_timeout);
+
+    if (hal_status == HAL_OK) {
+        hal_status = HAL_SPI_Transmit(p_setup->hspi, buff, len, p_setup->spi_timeout);
+    }
+
+    rf24_end_transaction(p_setup);
+
+    status = (rf24_platform_status_t) hal_status;
+    return status;
+}
+
+rf24_platform_status_t rf24_platform_read_payload_width(rf24_platform_t* p_setup, uint8_t* p_width) {
+    rf24_platform_status_t status;
+    HAL_StatusTypeDef hal_status;
+    nrf24l01_reg_status_t status_reg;
+
+    rf24_begin_transaction(p_setup);
+
+    uint8_t command = NRF24L01_COMM_R_RX_PL_WID;
+    hal_status = HAL_SPI_TransmitReceive(p_setup->hspi, &command, &(status_reg.value), 1, p_setup->spi_timeout);
+
+    if (hal_status == HAL_OK) {
+        hal_status = HAL_SPI_Receive(p_setup->hspi, p_width, 1, p_setup->spi_timeout);
+    }
+
+    rf24_end_transaction(p_setup);
+
+    status = (rf24_platform_status_t) hal_status;
+    return status;
+}
+
 /*****************************************
  * Private Functions Bodies Definitions
  *****************************************/
@@ -198,6 +253,11 @@ rf24_platform_status_t rf24_begin_transaction(rf24_platform_t* p_setup) {
 
     HAL_GPIO_WritePin(p_setup->csn_port, p_setup->csn_pin, GPIO_PIN_RESET);
 
+#ifdef RF24_HISTOGRAM
+    m_transaction_start_us = rf24_get_time_us();
+    m_transaction_active = true;
+#endif
+
     return status;
 }
 
@@ -206,5 +266,12 @@ rf24_platform_status_t rf24_end_transaction(rf24_platform_t* p_setup) {
 
     HAL_GPIO_WritePin(p_setup->csn_port, p_setup->csn_pin, GPIO_PIN_SET);
 
+#ifdef RF24_HISTOGRAM
+    if (m_transaction_active) {
+        RF24_HISTOGRAM_RECORD(RF24_HISTOGRAM_SPI, m_transaction_start_us);
+        m_transaction_active = false;
+    }
+#endif
+
     return status;
 }
@@ -0,0 +1,325 @@
+/**
+ * @file rf24_tdma.c
+ *
+ * @brief nRF24L01 beacon synchronized time division multiple access related.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_tdma.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define BEACON_ID 0xBE
+
+#define BEACON_ID_OFFSET 0
+#define BEACON_TIMESTAMP_OFFSET 1
+#define BEACON_SLOT_OFFSET 5
+#define BEACON_GUARD_OFFSET 9
+#define BEACON_NUM_OF_SLOTS_OFFSET 11
+#define BEACON_SLOT_MAP_OFFSET RF24_TDMA_BEACON_HEADER_SIZE
+
+/**
+ * @brief Number of consecutive missed beacons before the node drops the synchronization.
+ */
+#define MAX_MISSED_BEACONS 4
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Computes the slot lengths from the device configuration.
+ *
+ * @note A data slot has one guard time on each side plus one guard time
+ *       in which the transmission may start.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ */
+static void rf24_tdma_compute_slots(rf24_tdma_t* p_tdma);
+
+/**
+ * @brief Sends a beacon, starting a new superframe.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_tdma_send_beacon(rf24_tdma_t* p_tdma);
+
+/**
+ * @brief Synchronizes a node to a received beacon.
+ *
+ * @param p_tdma     Pointer to TDMA instance.
+ * @param beacon     Beacon payload.
+ * @param rx_time_us Local time the beacon arrived.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_tdma_parse_beacon(rf24_tdma_t* p_tdma, uint8_t* beacon, uint32_t rx_time_us);
+
+/**
+ * @brief Updates a node, listening for beacons.
+ *
+ * @param p_tdma Pointer to TDMA instance.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_tdma_node_update(rf24_tdma_t* p_tdma);
+
+static void rf24_tdma_put_u32(uint8_t* buff, uint32_t value);
+
+static uint32_t rf24_tdma_get_u32(uint8_t* buff);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+rf24_status_t rf24_tdma_init(rf24_tdma_t* p_tdma, rf24_dev_t* p_dev, rf24_tdma_config_t* p_config) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    if ((p_config->num_of_slots > RF24_TDMA_MAX_SLOTS) ||
+        (rf24_get_payload_capacity(p_dev) < RF24_TDMA_BEACON_HEADER_SIZE + p_config->num_of_slots)) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    memset(p_tdma, 0, sizeof(rf24_tdma_t));
+
+    p_tdma->p_dev = p_dev;
+    p_tdma->role = p_config->role;
+    p_tdma->node_id = p_config->node_id;
+
+    if (p_tdma->role == RF24_TDMA_BASE) {
+        p_tdma->num_of_slots = p_config->num_of_slots;
+        p_tdma->guard_us = p_config->guard_us;
+        memcpy(p_tdma->slot_map, p_config->slot_map, p_config->num_of_slots);
+        rf24_tdma_compute_slots(p_tdma);
+
+        dev_status = rf24_open_writing_pipe(p_dev, p_config->beacon_address);
+
+        if (dev_status == RF24_SUCCESS) {
+            dev_status = rf24_open_reading_pipe(p_dev, 1, p_config->base_address);
+        }
+
+        // The first update sends a beacon
+        p_tdma->superframe_start_us = rf24_get_time_us() - p_tdma->superframe_us;
+    } else {
+        dev_status = rf24_open_writing_pipe(p_dev, p_config->base_address);
+
+        if (dev_status == RF24_SUCCESS) {
+            dev_status = rf24_open_reading_pipe(p_dev, 1, p_config->beacon_address);
+        }
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_tdma_update(rf24_tdma_t* p_tdma) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    if (p_tdma->role == RF24_TDMA_NODE) {
+        return rf24_tdma_node_update(p_tdma);
+    }
+
+    if ((rf24_get_time_us() - p_tdma->superframe_start_us) >= p_tdma->superframe_us) {
+        dev_status = rf24_tdma_send_beacon(p_tdma);
+    }
+
+    if ((dev_status == RF24_SUCCESS) && !p_tdma->listening) {
+        dev_status = rf24_start_listening(p_tdma->p_dev);
+        p_tdma->listening = (dev_status == RF24_SUCCESS);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_tdma_write(rf24_tdma_t* p_tdma, uint8_t* buff, uint8_t len) {
+    if ((p_tdma->role != RF24_TDMA_NODE) || p_tdma->listening || (rf24_tdma_time_to_slot_us(p_tdma) != 0)) {
+        return RF24_BUSY;
+    }
+
+    return rf24_write(p_tdma->p_dev, buff, len, true);
+}
+
+uint32_t rf24_tdma_time_to_slot_us(rf24_tdma_t* p_tdma) {
+    uint32_t next_us = UINT32_MAX;
+
+    if (!p_tdma->synced) {
+        return UINT32_MAX;
+    }
+
+    int32_t elapsed_us = (int32_t) (rf24_get_time_us() - p_tdma->superframe_start_us);
+
+    for (uint8_t i = 0; i < p_tdma->num_of_slots; i++) {
+        if (p_tdma->slot_map[i] != p_tdma->node_id) {
+            continue;
+        }
+
+        int32_t start_us = (int32_t) (p_tdma->beacon_slot_us + i * p_tdma->slot_us + p_tdma->guard_us);
+
+        if (elapsed_us < start_us) {
+            if ((uint32_t) (start_us - elapsed_us) < next_us) {
+                next_us = (uint32_t) (start_us - elapsed_us);
+            }
+        } else if (elapsed_us < start_us + p_tdma->guard_us) {
+            return 0;
+        } else if ((uint32_t) (start_us + p_tdma->superframe_us - elapsed_us) < next_us) {
+            // Same slot on the next superframe
+            next_us = (uint32_t) (start_us + p_tdma->superframe_us - elapsed_us);
+        }
+    }
+
+    return next_us;
+}
+
+uint32_t rf24_tdma_get_network_time_us(rf24_tdma_t* p_tdma) {
+    return rf24_get_time_us() + (uint32_t) p_tdma->clock_offset_us;
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static void rf24_tdma_compute_slots(rf24_tdma_t* p_tdma) {
+    rf24_dev_t* p_dev = p_tdma->p_dev;
+
+    p_tdma->slot_us = rf24_worst_case_airtime_us(p_dev, p_dev->payload_size) + 3 * p_tdma->guard_us;
+    p_tdma->beacon_slot_us = rf24_airtime_us(p_dev, p_dev->payload_size, false) + 2 * p_tdma->guard_us;
+    p_tdma->superframe_us = p_tdma->beacon_slot_us + p_tdma->num_of_slots * p_tdma->slot_us;
+}
+
+static rf24_status_t rf24_tdma_send_beacon(rf24_tdma_t* p_tdma) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t beacon[RF24_MAX_PAYLOAD_SIZE] = {0};
+
+    if (p_tdma->listening) {
+        dev_status = rf24_stop_listening(p_tdma->p_dev);
+        p_tdma->listening = false;
+    }
+
+    beacon[BEACON_ID_OFFSET] = BEACON_ID;
+    rf24_tdma_put_u32(&(beacon[BEACON_SLOT_OFFSET]), p_tdma->slot_us);
+    beacon[BEACON_GUARD_OFFSET] = (uint8_t) (p_tdma->guard_us & 0xFF);
+    beacon[BEACON_GUARD_OFFSET + 1] = (uint8_t) (p_tdma->guard_us >> 8);
+    beacon[BEACON_NUM_OF_SLOTS_OFFSET] = p_tdma->num_of_slots;
+    memcpy(&(beacon[BEACON_SLOT_MAP_OFFSET]), p_tdma->slot_map, p_tdma->num_of_slots);
+
+    // The beacon time is the superframe start, taken as late as possible
+    p_tdma->superframe_start_us = rf24_get_time_us();
+    rf24_tdma_put_u32(&(beacon[BEACON_TIMESTAMP_OFFSET]), p_tdma->superframe_start_us);
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_write(p_tdma->p_dev, beacon, rf24_get_payload_capacity(p_tdma->p_dev), false);
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        p_tdma->stats.beacons_sent++;
+    }
+
+    return dev_status;
+}
+
+static rf24_status_t rf24_tdma_parse_beacon(rf24_tdma_t* p_tdma, uint8_t* beacon, uint32_t rx_time_us) {
+    if ((beacon[BEACON_ID_OFFSET] != BEACON_ID) ||
+        (beacon[BEACON_NUM_OF_SLOTS_OFFSET] > RF24_TDMA_MAX_SLOTS) ||
+        (rf24_get_payload_capacity(p_tdma->p_dev) <
+         RF24_TDMA_BEACON_HEADER_SIZE + beacon[BEACON_NUM_OF_SLOTS_OFFSET])) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    p_tdma->num_of_slots = beacon[BEACON_NUM_OF_SLOTS_OFFSET];
+    p_tdma->guard_us = (uint16_t) (beacon[BEACON_GUARD_OFFSET] | (beacon[BEACON_GUARD_OFFSET + 1] << 8));
+    memcpy(p_tdma->slot_map, &(beacon[BEACON_SLOT_MAP_OFFSET]), p_tdma->num_of_slots);
+    rf24_tdma_compute_slots(p_tdma);
+
+    if (rf24_tdma_get_u32(&(beacon[BEACON_SLOT_OFFSET])) != p_tdma->slot_us) {
+        // Base and node are configured with different datarates or retries
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    // The beacon was sent one airtime before it was received
+    p_tdma->superframe_start_us = rx_time_us - rf24_airtime_us(p_tdma->p_dev, p_tdma->p_dev->payload_size, false);
+    p_tdma->clock_offset_us =
+        (int32_t) (rf24_tdma_get_u32(&(beacon[BEACON_TIMESTAMP_OFFSET])) - p_tdma->superframe_start_us);
+
+    p_tdma->synced = true;
+    p_tdma->missed_beacons = 0;
+    p_tdma->stats.beacons_received++;
+
+    return RF24_SUCCESS;
+}
+
+static rf24_status_t rf24_tdma_node_update(rf24_tdma_t* p_tdma) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint8_t beacon[RF24_MAX_PAYLOAD_SIZE];
+    int32_t elapsed_us = (int32_t) (rf24_get_time_us() - p_tdma->superframe_start_us);
+
+    // Wake up one guard time before the next beacon is expected
+    if (!p_tdma->listening &&
+        (!p_tdma->synced || (elapsed_us >= (int32_t) (p_tdma->superframe_us - p_tdma->guard_us)))) {
+        dev_status = rf24_start_listening(p_tdma->p_dev);
+        p_tdma->listening = (dev_status == RF24_SUCCESS);
+    }
+
+    if (!p_tdma->listening) {
+        return dev_status;
+    }
+
+    dev_status = rf24_available(p_tdma->p_dev, NULL);
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_read(p_tdma->p_dev, beacon, p_tdma->p_dev->payload_size);
+
+        // Arrival time of the beacon, not the time this poll found it
+        if ((dev_status == RF24_SUCCESS) &&
+            (rf24_tdma_parse_beacon(p_tdma, beacon, rf24_get_rx_timestamp_us(p_tdma->p_dev)) == RF24_SUCCESS)) {
+            dev_status = rf24_stop_listening(p_tdma->p_dev);
+            p_tdma->listening = false;
+        }
+
+        return (dev_status == RF24_DUPLICATE) ? (RF24_SUCCESS) : (dev_status);
+    }
+
+    if (dev_status != RF24_RX_FIFO_EMPTY) {
+        return dev_status;
+    }
+
+    dev_status = RF24_SUCCESS;
+
+    // Beacon slot is over, keep the schedule until too many beacons are missed
+    if (p_tdma->synced && (elapsed_us >= (int32_t) (p_tdma->superframe_us + p_tdma->beacon_slot_us))) {
+        p_tdma->superframe_start_us += p_tdma->superframe_us;
+        p_tdma->missed_beacons++;
+        p_tdma->stats.beacons_missed++;
+
+        if (p_tdma->missed_beacons >= MAX_MISSED_BEACONS) {
+            p_tdma->synced = false;
+            p_tdma->stats.sync_losses++;
+        } else {
+            dev_status = rf24_stop_listening(p_tdma->p_dev);
+            p_tdma->listening = false;
+        }
+    }
+
+    return dev_status;
+}
+
+static void rf24_tdma_put_u32(uint8_t* buff, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        buff[i] = (uint8_t) (value >> (8 * i));
+    }
+}
+
+static uint32_t rf24_tdma_get_u32(uint8_t* buff) {
+    uint32_t value = 0;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        value |= ((uint32_t) buff[i]) << (8 * i);
+    }
+
+    return value;
+}
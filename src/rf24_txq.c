@@ -0,0 +1,240 @@
+/**
+ * @file rf24_txq.c
+ *
+ * @brief nRF24L01 prioritized transmission queue, with per frame expiry and preemption.
+ *
+ * @date 10/2026
+ */
+
+#include <string.h>
+
+#include "rf24_txq.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+#define STATUS_REG_ERROR_VALUE 0xFF
+
+/*****************************************
+ * Private Functions Prototypes
+ *****************************************/
+
+/**
+ * @brief Checks whether a frame is stale.
+ *
+ * @param p_frame Pointer to frame.
+ * @param now_us  Current time.
+ *
+ * @return Whether the frame expired.
+ */
+static bool rf24_txq_expired(const rf24_txq_frame_t* p_frame, uint32_t now_us);
+
+/**
+ * @brief Gets the most urgent class with queued frames.
+ *
+ * @param p_txq Pointer to transmission queue.
+ *
+ * @return Priority class, @ref RF24_TXQ_NUM_OF_PRIORITIES when all are empty.
+ */
+static rf24_txq_priority_t rf24_txq_highest(rf24_txq_t* p_txq);
+
+/**
+ * @brief Takes the frame being sent back from the device, leaving the chip disabled.
+ *
+ * @param p_txq Pointer to transmission queue.
+ *
+ * @return @ref rf24_status.
+ */
+static rf24_status_t rf24_txq_abort(rf24_txq_t* p_txq);
+
+/**
+ * @brief Queues a frame again in front of its class.
+ *
+ * @note With the class queue full its newest frame is dropped.
+ *
+ * @param p_txq   Pointer to transmission queue.
+ * @param p_frame Pointer to frame.
+ */
+static void rf24_txq_push_front(rf24_txq_t* p_txq, const rf24_txq_frame_t* p_frame);
+
+/**
+ * @brief Removes the most urgent frame that did not expire, dropping the expired ones.
+ *
+ * @param p_txq   Pointer to transmission queue.
+ * @param now_us  Current time.
+ * @param p_frame Pointer to store the frame.
+ *
+ * @return Whether a frame was removed.
+ */
+static bool rf24_txq_pop(rf24_txq_t* p_txq, uint32_t now_us, rf24_txq_frame_t* p_frame);
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+void rf24_txq_init(rf24_txq_t* p_txq, rf24_dev_t* p_dev) {
+    memset(p_txq, 0, sizeof(rf24_txq_t));
+
+    p_txq->p_dev = p_dev;
+}
+
+rf24_status_t rf24_txq_push(rf24_txq_t* p_txq, uint8_t* buff, uint8_t len, bool enable_auto_ack,
+                            rf24_txq_priority_t priority, uint32_t lifetime_us) {
+    if ((priority >= RF24_TXQ_NUM_OF_PRIORITIES) || (len > rf24_get_payload_capacity(p_txq->p_dev))) {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    rf24_txq_class_t* p_class = &(p_txq->classes[priority]);
+
+    if (p_class->count == RF24_TXQ_QUEUE_SIZE) {
+        p_class->head = (p_class->head + 1) % RF24_TXQ_QUEUE_SIZE;
+        p_class->count--;
+        p_txq->stats.overwritten++;
+    }
+
+    rf24_txq_frame_t* p_frame = &(p_class->frames[(p_class->head + p_class->count) % RF24_TXQ_QUEUE_SIZE]);
+
+    memcpy(p_frame->data, buff, len);
+    p_frame->size = len;
+    p_frame->enable_auto_ack = enable_auto_ack;
+    p_frame->priority = priority;
+    p_frame->expires = (lifetime_us != RF24_TXQ_NO_EXPIRY);
+    p_frame->expiry_us = rf24_get_time_us() + lifetime_us;
+
+    p_class->count++;
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_txq_update(rf24_txq_t* p_txq) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint32_t now_us = rf24_get_time_us();
+
+    if (p_txq->has_in_flight) {
+        nrf24l01_reg_status_t status_reg = rf24_get_status(p_txq->p_dev);
+
+        if (status_reg.value == STATUS_REG_ERROR_VALUE) {
+            return RF24_ERROR_CONTROL_INTERFACE;
+        }
+
+        if (status_reg.tx_ds || status_reg.max_rt) {
+            // Clears the flags, flushing the frame on max retransmissions
+            dev_status = rf24_tx_standby(p_txq->p_dev);
+
+            if (dev_status == RF24_SUCCESS) {
+                p_txq->stats.sent++;
+            } else if (dev_status == RF24_MAX_RETRANSMIT) {
+                p_txq->stats.failed++;
+                dev_status = RF24_SUCCESS;
+            } else {
+                return dev_status;
+            }
+
+            p_txq->has_in_flight = false;
+        } else if (rf24_txq_expired(&(p_txq->in_flight), now_us)) {
+            dev_status = rf24_txq_abort(p_txq);
+
+            if (dev_status != RF24_SUCCESS) {
+                return dev_status;
+            }
+
+            p_txq->stats.expired++;
+        } else if (rf24_txq_highest(p_txq) < p_txq->in_flight.priority) {
+            dev_status = rf24_txq_abort(p_txq);
+
+            if (dev_status != RF24_SUCCESS) {
+                return dev_status;
+            }
+
+            rf24_txq_push_front(p_txq, &(p_txq->in_flight));
+            p_txq->stats.preempted++;
+        }
+    }
+
+    if (!p_txq->has_in_flight && rf24_txq_pop(p_txq, now_us, &(p_txq->in_flight))) {
+        rf24_txq_frame_t* p_frame = &(p_txq->in_flight);
+
+        dev_status = rf24_write_fast(p_txq->p_dev, p_frame->data, p_frame->size, p_frame->enable_auto_ack);
+
+        if (dev_status == RF24_SUCCESS) {
+            p_txq->has_in_flight = true;
+        } else {
+            rf24_txq_push_front(p_txq, p_frame);
+        }
+    }
+
+    return dev_status;
+}
+
+uint8_t rf24_txq_pending(rf24_txq_t* p_txq) {
+    uint8_t pending = p_txq->has_in_flight ? 1 : 0;
+
+    for (uint8_t i = 0; i < RF24_TXQ_NUM_OF_PRIORITIES; i++) {
+        pending += p_txq->classes[i].count;
+    }
+
+    return pending;
+}
+
+/*****************************************
+ * Private Functions Bodies Definitions
+ *****************************************/
+
+static bool rf24_txq_expired(const rf24_txq_frame_t* p_frame, uint32_t now_us) {
+    return p_frame->expires && ((int32_t) (now_us - p_frame->expiry_us) >= 0);
+}
+
+static rf24_txq_priority_t rf24_txq_highest(rf24_txq_t* p_txq) {
+    for (uint8_t i = 0; i < RF24_TXQ_NUM_OF_PRIORITIES; i++) {
+        if (p_txq->classes[i].count > 0) {
+            return (rf24_txq_priority_t) i;
+        }
+    }
+
+    return RF24_TXQ_NUM_OF_PRIORITIES;
+}
+
+static rf24_status_t rf24_txq_abort(rf24_txq_t* p_txq) {
+    // The frame may end between the status read and the flush, then it is sent twice
+    rf24_status_t dev_status = rf24_tx_abort(p_txq->p_dev);
+
+    if (dev_status == RF24_SUCCESS) {
+        p_txq->has_in_flight = false;
+    }
+
+    return dev_status;
+}
+
+static void rf24_txq_push_front(rf24_txq_t* p_txq, const rf24_txq_frame_t* p_frame) {
+    rf24_txq_class_t* p_class = &(p_txq->classes[p_frame->priority]);
+
+    if (p_class->count == RF24_TXQ_QUEUE_SIZE) {
+        p_class->count--;
+        p_txq->stats.overwritten++;
+    }
+
+    p_class->head = (p_class->head + RF24_TXQ_QUEUE_SIZE - 1) % RF24_TXQ_QUEUE_SIZE;
+    p_class->frames[p_class->head] = *p_frame;
+    p_class->count++;
+}
+
+static bool rf24_txq_pop(rf24_txq_t* p_txq, uint32_t now_us, rf24_txq_frame_t* p_frame) {
+    for (uint8_t i = 0; i < RF24_TXQ_NUM_OF_PRIORITIES; i++) {
+        rf24_txq_class_t* p_class = &(p_txq->classes[i]);
+
+        while (p_class->count > 0) {
+            *p_frame = p_class->frames[p_class->head];
+            p_class->head = (p_class->head + 1) % RF24_TXQ_QUEUE_SIZE;
+            p_class->count--;
+
+            if (!rf24_txq_expired(p_frame, now_us)) {
+                return true;
+            }
+
+            p_txq->stats.expired++;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file rf24_wor.c
+ *
+ * @brief nRF24L01 duty cycled receiver (wake on radio) related.
+ *
+ * @date 10/2026
+ */
+
+#include "rf24_wor.h"
+
+/*****************************************
+ * Private Constants
+ *****************************************/
+
+/**
+ * @brief Number of wake up packets that fit in a receive window.
+ *
+ * @note A window starting in the middle of a packet only receives the next one.
+ */
+#define PACKETS_PER_WINDOW 2U
+
+/*****************************************
+ * Public Functions Bodies Definitions
+ *****************************************/
+
+rf24_status_t rf24_wor_init(rf24_wor_t* p_wor, rf24_dev_t* p_dev, uint32_t max_latency_us, uint8_t payload_len) {
+    uint32_t power_down_wake_us = rf24_get_wake_latency_us(RF24_POWER_DOWN);
+    uint32_t standby_wake_us = rf24_get_wake_latency_us(RF24_STANDBY_I);
+
+    p_wor->p_dev = p_dev;
+    p_wor->listening = false;
+    p_wor->window_start_us = rf24_get_time_us();
+
+    // With auto acknowledgement disabled, each packet takes its settling time and airtime
+    p_wor->window_us = standby_wake_us + PACKETS_PER_WINDOW * rf24_airtime_us(p_dev, payload_len, false);
+
+    // A burst starting right after a window is caught by the next one
+    if (max_latency_us >= 2 * p_wor->window_us + power_down_wake_us) {
+        p_wor->sleep_state = RF24_POWER_DOWN;
+        p_wor->period_us = max_latency_us - p_wor->window_us - power_down_wake_us;
+    } else if (max_latency_us >= 2 * p_wor->window_us + standby_wake_us) {
+        p_wor->sleep_state = RF24_STANDBY_I;
+        p_wor->period_us = max_latency_us - p_wor->window_us - standby_wake_us;
+    } else {
+        return RF24_INVALID_PARAMETERS;
+    }
+
+    return RF24_SUCCESS;
+}
+
+rf24_status_t rf24_wor_update(rf24_wor_t* p_wor) {
+    rf24_status_t dev_status = RF24_RX_FIFO_EMPTY;
+    uint32_t now_us = rf24_get_time_us();
+
+    if (!p_wor->listening) {
+        if ((now_us - p_wor->window_start_us) < p_wor->period_us) {
+            return RF24_RX_FIFO_EMPTY;
+        }
+
+        dev_status = rf24_start_listening(p_wor->p_dev);
+
+        if (dev_status != RF24_SUCCESS) {
+            return dev_status;
+        }
+
+        p_wor->listening = true;
+        p_wor->window_start_us = rf24_get_time_us();
+        now_us = p_wor->window_start_us;
+    }
+
+    dev_status = rf24_available(p_wor->p_dev, NULL);
+
+    if ((dev_status == RF24_RX_FIFO_EMPTY) && ((now_us - p_wor->window_start_us) >= p_wor->window_us)) {
+        dev_status = rf24_wor_resume(p_wor);
+        dev_status = (dev_status == RF24_SUCCESS) ? (RF24_RX_FIFO_EMPTY) : (dev_status);
+    }
+
+    return dev_status;
+}
+
+rf24_status_t rf24_wor_resume(rf24_wor_t* p_wor) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+
+    dev_status = rf24_stop_listening(p_wor->p_dev);
+
+    if ((dev_status == RF24_SUCCESS) && (p_wor->sleep_state == RF24_POWER_DOWN)) {
+        dev_status = rf24_power_down(p_wor->p_dev);
+    }
+
+    p_wor->listening = false;
+
+    return dev_status;
+}
+
+rf24_status_t rf24_wor_send_wakeup(rf24_wor_t* p_wor, uint8_t* buff, uint8_t len) {
+    rf24_status_t dev_status = RF24_SUCCESS;
+    uint32_t burst_us = p_wor->period_us + p_wor->window_us + rf24_airtime_us(p_wor->p_dev, len, false);
+
+    dev_status = rf24_write_continuously(p_wor->p_dev, buff, len);
+
+    if (dev_status == RF24_SUCCESS) {
+        uint32_t start_us = rf24_get_time_us();
+
+        while ((rf24_get_time_us() - start_us) < burst_us) {
+        }
+    }
+
+    if (dev_status == RF24_SUCCESS) {
+        dev_status = rf24_stop_write_continuously(p_wor->p_dev);
+    }
+
+    return dev_status;
+}
+
+uint32_t rf24_wor_get_duty_cycle_ppm(rf24_wor_t* p_wor) {
+    // Windows open once per period, which already includes the window itself
+    return (uint32_t) (((uint64_t) p_wor->window_us * 1000000U) / p_wor->period_us);
+}